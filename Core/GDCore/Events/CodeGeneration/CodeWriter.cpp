@@ -0,0 +1,79 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/CodeWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace gd {
+
+constexpr std::size_t CodeWriter::chunkCapacity;
+
+void CodeWriter::Write(const char* code, std::size_t length) {
+  if (length == 0) return;
+
+  // Only start a new chunk when the last one is full, so that the code
+  // already written is never moved.
+  if (chunks.empty() ||
+      chunks.back().size() + length > chunks.back().capacity()) {
+    chunks.emplace_back();
+    chunks.back().reserve(std::max(chunkCapacity, length));
+  }
+
+  chunks.back().append(code, length);
+  size += length;
+}
+
+CodeWriter& CodeWriter::Write(gd::String&& code) {
+  std::string& rawCode = code.Raw();
+  if (rawCode.size() < chunkCapacity) {
+    Write(rawCode.data(), rawCode.size());
+    return *this;
+  }
+
+  // Keep the remaining space of the last chunk usable for the next writes.
+  size += rawCode.size();
+  if (!chunks.empty() && chunks.back().size() < chunks.back().capacity()) {
+    chunks.insert(chunks.end() - 1, std::move(rawCode));
+    std::swap(chunks[chunks.size() - 1], chunks[chunks.size() - 2]);
+  } else {
+    chunks.push_back(std::move(rawCode));
+  }
+
+  return *this;
+}
+
+CodeWriter& CodeWriter::Write(const char* code) {
+  Write(code, std::strlen(code));
+  return *this;
+}
+
+CodeWriter& CodeWriter::Write(const CodeWriter& otherWriter) {
+  for (const std::string& chunk : otherWriter.chunks)
+    Write(chunk.data(), chunk.size());
+
+  return *this;
+}
+
+gd::String CodeWriter::ToString() const {
+  gd::String output;
+  AppendTo(output);
+  return output;
+}
+
+void CodeWriter::AppendTo(gd::String& output) const {
+  std::string& rawOutput = output.Raw();
+  rawOutput.reserve(rawOutput.size() + size);
+  for (const std::string& chunk : chunks) rawOutput.append(chunk);
+}
+
+void CodeWriter::Clear() {
+  chunks.clear();
+  size = 0;
+}
+
+}  // namespace gd
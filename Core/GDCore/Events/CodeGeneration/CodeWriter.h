@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An appendable buffer of generated code.
+ *
+ * The code is stored in chunks which are never reallocated when more code is
+ * written: appending is done without copying the code already written, and
+ * large pieces of code given as temporaries are moved into the buffer instead
+ * of being copied. The final code is built once, with ToString or AppendTo.
+ *
+ * Use it instead of chaining `gd::String` concatenations when generating
+ * large amounts of code.
+ */
+class GD_CORE_API CodeWriter {
+ public:
+  CodeWriter() : size(0){};
+  virtual ~CodeWriter(){};
+
+  /**
+   * \brief Append some code.
+   */
+  CodeWriter& Write(const gd::String& code) {
+    Write(code.Raw().data(), code.Raw().size());
+    return *this;
+  };
+
+  /**
+   * \brief Append some code, moving it into the buffer if it's large enough
+   * to be stored as its own chunk.
+   */
+  CodeWriter& Write(gd::String&& code);
+
+  /**
+   * \brief Append some code.
+   */
+  CodeWriter& Write(const char* code);
+
+  /**
+   * \brief Append the code of another writer.
+   */
+  CodeWriter& Write(const CodeWriter& otherWriter);
+
+  CodeWriter& operator<<(const gd::String& code) { return Write(code); };
+  CodeWriter& operator<<(gd::String&& code) { return Write(std::move(code)); };
+  CodeWriter& operator<<(const char* code) { return Write(code); };
+  CodeWriter& operator<<(const CodeWriter& otherWriter) {
+    return Write(otherWriter);
+  };
+
+  /**
+   * \brief Return the size, in bytes, of the code written so far.
+   */
+  std::size_t GetSize() const { return size; };
+
+  /**
+   * \brief Return true if no code was written.
+   */
+  bool IsEmpty() const { return size == 0; };
+
+  /**
+   * \brief Build a string containing all the code written.
+   */
+  gd::String ToString() const;
+
+  /**
+   * \brief Append all the code written to \a output, which is grown only
+   * once.
+   */
+  void AppendTo(gd::String& output) const;
+
+  /**
+   * \brief Remove all the code written.
+   */
+  void Clear();
+
+ private:
+  void Write(const char* code, std::size_t length);
+
+  std::vector<std::string> chunks;
+  std::size_t size;
+
+  static constexpr std::size_t chunkCapacity = 16 * 1024;
+};
+
+}  // namespace gd
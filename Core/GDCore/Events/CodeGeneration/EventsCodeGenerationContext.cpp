@@ -5,6 +5,7 @@
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 
+#include <limits>
 #include <set>
 
 #include "GDCore/CommonTools.h"
@@ -13,27 +14,91 @@
 
 using namespace std;
 
+namespace {
+
+const unsigned int noDepth = std::numeric_limits<unsigned int>::max();
+
+bool HasId(const std::vector<uint64_t>& idsSet, std::size_t id) {
+  return id / 64 < idsSet.size() && (idsSet[id / 64] >> (id % 64)) & 1;
+}
+
+void AddId(std::vector<uint64_t>& idsSet, std::size_t id) {
+  if (id / 64 >= idsSet.size()) idsSet.resize(id / 64 + 1, 0);
+  idsSet[id / 64] |= uint64_t(1) << (id % 64);
+}
+
+}  // namespace
+
 namespace gd {
 
+std::size_t EventsCodeGenerationContext::ObjectsListsNames::GetOrAddId(
+    const gd::String& objectName) {
+  auto it = ids.find(objectName);
+  if (it != ids.end()) return it->second;
+
+  std::size_t id = names.size();
+  ids.emplace(objectName, id);
+  names.push_back(objectName);
+  return id;
+}
+
+bool EventsCodeGenerationContext::ObjectsListsNames::GetId(
+    const gd::String& objectName, std::size_t& id) const {
+  auto it = ids.find(objectName);
+  if (it == ids.end()) return false;
+
+  id = it->second;
+  return true;
+}
+
+EventsCodeGenerationContext::ObjectsListsNames&
+EventsCodeGenerationContext::GetObjectsListsNames() {
+  if (!objectsListsNames)
+    objectsListsNames = std::make_shared<ObjectsListsNames>();
+
+  return *objectsListsNames;
+}
+
+const std::shared_ptr<const EventsCodeGenerationContext::ObjectsListsIdsSet>&
+EventsCodeGenerationContext::GetObjectsListsDeclaredForChildren() {
+  if (objectsListsDeclaredForChildren) return objectsListsDeclaredForChildren;
+
+  if (objectsListsToBeDeclared.empty() &&
+      objectsListsOrEmptyToBeDeclared.empty() &&
+      emptyObjectsListsToBeDeclared.empty()) {
+    // Nothing declared here: children can share the set of the parents.
+    return alreadyDeclaredObjectsLists;
+  }
+
+  // Objects lists declared by this context become "already declared" in the
+  // children contexts. The set is computed once and shared by all of them.
+  auto declaredForChildren =
+      alreadyDeclaredObjectsLists
+          ? std::make_shared<ObjectsListsIdsSet>(*alreadyDeclaredObjectsLists)
+          : std::make_shared<ObjectsListsIdsSet>();
+  ObjectsListsNames& names = GetObjectsListsNames();
+  for (const auto* objectsLists : {&objectsListsToBeDeclared,
+                                   &objectsListsOrEmptyToBeDeclared,
+                                   &emptyObjectsListsToBeDeclared}) {
+    for (const gd::String& objectName : *objectsLists)
+      AddId(*declaredForChildren, names.GetOrAddId(objectName));
+  }
+
+  objectsListsDeclaredForChildren = declaredForChildren;
+  return objectsListsDeclaredForChildren;
+}
+
 void EventsCodeGenerationContext::InheritsFrom(
     EventsCodeGenerationContext& parent_) {
   parent = &parent_;
 
   // Objects lists declared by parent became "already declared" in the child
-  // context.
-  alreadyDeclaredObjectsLists = parent_.alreadyDeclaredObjectsLists;
-  std::copy(parent_.objectsListsToBeDeclared.begin(),
-            parent_.objectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.objectsListsOrEmptyToBeDeclared.begin(),
-            parent_.objectsListsOrEmptyToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.emptyObjectsListsToBeDeclared.begin(),
-            parent_.emptyObjectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
+  // context. The identifiers and the sets are shared with the parent, so
+  // that inheriting does not copy anything.
+  parent_.GetObjectsListsNames();
+  objectsListsNames = parent_.objectsListsNames;
+  alreadyDeclaredObjectsLists = parent_.GetObjectsListsDeclaredForChildren();
+  objectsListsDeclaredForChildren = nullptr;
 
   nearestAsyncParent = parent_.IsAsyncCallback() ? &parent_ : parent_.nearestAsyncParent;
   asyncDepth = parent_.asyncDepth;
@@ -68,39 +133,83 @@ void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd
     asyncContext->allObjectsListToBeDeclaredAcrossChildren.insert(objectName);
 }
 
+void EventsCodeGenerationContext::ObjectsListDeclared() {
+  objectsListsDeclaredForChildren = nullptr;
+}
+
+void EventsCodeGenerationContext::SetDepthOfLastUse(
+    const gd::String& objectName) {
+  std::size_t id = GetObjectsListsNames().GetOrAddId(objectName);
+
+  // Copy the depths shared with the parent (or siblings) before modifying
+  // them.
+  if (!depthOfLastUse)
+    depthOfLastUse = std::make_shared<std::vector<unsigned int>>();
+  else if (depthOfLastUse.use_count() > 1)
+    depthOfLastUse = std::make_shared<std::vector<unsigned int>>(*depthOfLastUse);
+
+  if (id >= depthOfLastUse->size()) depthOfLastUse->resize(id + 1, noDepth);
+  (*depthOfLastUse)[id] = GetContextDepth();
+}
+
 void EventsCodeGenerationContext::ObjectsListNeeded(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
     objectsListsToBeDeclared.insert(objectName);
+    ObjectsListDeclared();
 
     if (IsInsideAsync()) {
       NotifyAsyncParentsAboutDeclaredObject(objectName);
     }
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  SetDepthOfLastUse(objectName);
 }
 
 void EventsCodeGenerationContext::ObjectsListNeededOrEmptyIfJustDeclared(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
     objectsListsOrEmptyToBeDeclared.insert(objectName);
+    ObjectsListDeclared();
 
     if (IsInsideAsync()) {
       NotifyAsyncParentsAboutDeclaredObject(objectName);
     }
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  SetDepthOfLastUse(objectName);
 }
 
 void EventsCodeGenerationContext::EmptyObjectsListNeeded(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
     emptyObjectsListsToBeDeclared.insert(objectName);
+    ObjectsListDeclared();
+  }
+
+  SetDepthOfLastUse(objectName);
+}
+
+bool EventsCodeGenerationContext::ObjectAlreadyDeclaredByParents(
+    const gd::String& objectName) const {
+  std::size_t id;
+  return alreadyDeclaredObjectsLists && objectsListsNames &&
+         objectsListsNames->GetId(objectName, id) &&
+         HasId(*alreadyDeclaredObjectsLists, id);
+}
+
+std::set<gd::String>
+EventsCodeGenerationContext::GetObjectsListsAlreadyDeclaredByParents() const {
+  std::set<gd::String> alreadyDeclared;
+  if (!alreadyDeclaredObjectsLists || !objectsListsNames)
+    return alreadyDeclared;
+
+  for (std::size_t i = 0; i < alreadyDeclaredObjectsLists->size() * 64; ++i) {
+    if (HasId(*alreadyDeclaredObjectsLists, i))
+      alreadyDeclared.insert(objectsListsNames->GetName(i));
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  return alreadyDeclared;
 }
 
 std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
@@ -117,7 +226,11 @@ std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
 
 unsigned int EventsCodeGenerationContext::GetLastDepthObjectListWasNeeded(
     const gd::String& name) const {
-  if (depthOfLastUse.count(name) != 0) return depthOfLastUse.find(name)->second;
+  std::size_t id;
+  if (depthOfLastUse && objectsListsNames &&
+      objectsListsNames->GetId(name, id) && id < depthOfLastUse->size() &&
+      (*depthOfLastUse)[id] != noDepth)
+    return (*depthOfLastUse)[id];
 
   std::cout << "WARNING: During code generation, the last depth of an object "
                "list was 0."
@@ -5,9 +5,11 @@
  */
 #pragma once
 
-#include <map>
+#include <cstdint>
 #include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "GDCore/String.h"
 
@@ -139,10 +141,7 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return true if an object list has already been declared by the parent contexts.
    */
-  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const {
-    return (alreadyDeclaredObjectsLists.find(objectName) !=
-            alreadyDeclaredObjectsLists.end());
-  };
+  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const;
 
   /**
    * Return all the objects lists which will be declared by the current context
@@ -178,10 +177,11 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return the objects lists which are already declared and can be used in the
    * current context without declaration.
+   *
+   * \note The set is built on each call: prefer ObjectAlreadyDeclaredByParents
+   * to check a single objects list.
    */
-  const std::set<gd::String>& GetObjectsListsAlreadyDeclaredByParents() const {
-    return alreadyDeclaredObjectsLists;
-  };
+  std::set<gd::String> GetObjectsListsAlreadyDeclaredByParents() const;
 
   /**
    * \brief Get the depth of the context that was in effect when \a objectName
@@ -283,11 +283,48 @@ class GD_CORE_API EventsCodeGenerationContext {
   };
 
  private:
-  void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
+  /**
+   * \brief The names of the objects lists used during a code generation, each
+   * associated to an integer identifier.
+   *
+   * It is shared by a context and all its children, so that the objects lists
+   * inherited from the parents can be stored as sets of identifiers shared
+   * between contexts.
+   */
+  class ObjectsListsNames {
+   public:
+    std::size_t GetOrAddId(const gd::String& objectName);
+    bool GetId(const gd::String& objectName, std::size_t& id) const;
+    const gd::String& GetName(std::size_t id) const { return names[id]; }
+
+   private:
+    std::unordered_map<gd::String, std::size_t> ids;
+    std::vector<gd::String> names;
+  };
 
-  std::set<gd::String>
+  /**
+   * \brief A set of objects lists identifiers, one bit per identifier.
+   */
+  typedef std::vector<uint64_t> ObjectsListsIdsSet;
+
+  void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
+  void ObjectsListDeclared();
+  void SetDepthOfLastUse(const gd::String& objectName);
+  ObjectsListsNames& GetObjectsListsNames();
+  const std::shared_ptr<const ObjectsListsIdsSet>&
+  GetObjectsListsDeclaredForChildren();
+
+  std::shared_ptr<ObjectsListsNames>
+      objectsListsNames;  ///< The identifiers of the objects lists, shared
+                          ///< with the parent and children contexts.
+  std::shared_ptr<const ObjectsListsIdsSet>
       alreadyDeclaredObjectsLists;  ///< Objects lists already needed in a
-                                    ///< parent context.
+                                    ///< parent context. Shared with the
+                                    ///< parent and the siblings when possible.
+  std::shared_ptr<const ObjectsListsIdsSet>
+      objectsListsDeclaredForChildren;  ///< Cache of the objects lists
+                                        ///< already declared for the
+                                        ///< children contexts.
   std::set<gd::String>
       objectsListsToBeDeclared;  ///< Objects lists that will be declared in
                                  ///< this context.
@@ -311,8 +348,10 @@ class GD_CORE_API EventsCodeGenerationContext {
                                                  ///< necessary objects can be
                                                  ///< backed up.
 
-  std::map<gd::String, unsigned int>
-      depthOfLastUse;  ///< The context depth when an object was last used.
+  std::shared_ptr<std::vector<unsigned int>>
+      depthOfLastUse;  ///< The context depth when an object was last used,
+                       ///< by objects list identifier. Shared with the parent
+                       ///< until it's modified.
   gd::String
       currentObject;  ///< The object being used by an action or condition.
   unsigned int contextDepth = 0;  ///< The depth of the context: 0 for a newly
@@ -1091,7 +1091,7 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
  */
 gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::EventsList& events, EventsCodeGenerationContext& parentContext) {
-  gd::String output;
+  gd::CodeWriter output;
   bool hasAnyElseEvent = false;
   bool elseChainCanContinue = false;
   for (std::size_t eId = 0; eId < events.size(); ++eId) {
@@ -1173,22 +1173,21 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    output << "\n" << scopeBegin << "\n" << declarationsCode << "\n"
+           << std::move(eventCoreCode) << "\n" << scopeEnd << "\n";
 
     if (event.HasVariables()) {
       GetProjectScopedContainers().GetVariablesContainersList().Pop();
     }
   }
 
-  if (hasAnyElseEvent) {
-    output = GenerateScopeBegin(parentContext) +
-      "\nlet elseEventsChainSatisfied = false;\n" +
-      output +
-      GenerateScopeEnd(parentContext);
-  }
+  if (!hasAnyElseEvent) return output.ToString();
 
-  return output;
+  gd::String code = GenerateScopeBegin(parentContext) +
+                    "\nlet elseEventsChainSatisfied = false;\n";
+  output.AppendTo(code);
+  code += GenerateScopeEnd(parentContext);
+  return code;
 }
 
 gd::String EventsCodeGenerator::ConvertToString(gd::String plainString) {
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "GDCore/Events/CodeGeneration/CodeWriter.h"
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
@@ -283,7 +284,7 @@ class GD_CORE_API EventsCodeGenerator {
    * \brief Add some code before events outside the main function.
    */
   void AddCustomCodeOutsideMain(gd::String code) {
-    customCodeOutsideMain += code;
+    customCodeOutsideMain.Write(std::move(code));
   };
 
   /** \brief Get the set containing the include files.
@@ -292,7 +293,7 @@ class GD_CORE_API EventsCodeGenerator {
 
   /** \brief Get the custom code to be inserted outside main.
    */
-  const gd::String& GetCustomCodeOutsideMain() const {
+  const gd::CodeWriter& GetCustomCodeOutsideMain() const {
     return customCodeOutsideMain;
   }
 
@@ -864,8 +865,9 @@ class GD_CORE_API EventsCodeGenerator {
       includeFiles;  ///< List of headers files used by instructions. A (shared)
                      ///< pointer is used so as context created from another one
                      ///< can share the same list.
-  gd::String customCodeOutsideMain;  ///< Custom code inserted before events (
-                                     ///< and not in events function )
+  gd::CodeWriter customCodeOutsideMain;  ///< Custom code inserted before
+                                         ///< events (and not in events
+                                         ///< function)
   std::set<gd::String>
       customGlobalDeclarations;     ///< Custom global C++ declarations inserted
                                     ///< after includes
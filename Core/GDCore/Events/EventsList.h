@@ -131,6 +131,13 @@ class GD_CORE_API EventsList {
    */
   void Clear() { return events.clear(); };
 
+  /**
+   * \brief Exchange the events of this list with the events of another list.
+   *
+   * \note Events are not copied, so pointers to them stay valid.
+   */
+  void Swap(gd::EventsList& other) { events.swap(other.events); };
+
   /** \name Utilities
    * Utility methods
    */
@@ -7,6 +7,7 @@
 #include "GDCore/Events/Expression.h"
 
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
 #include "GDCore/String.h"
 
 namespace gd {
@@ -19,23 +20,47 @@ Expression::Expression(gd::String plainString_)
 Expression::Expression(const char* plainString_)
     : node(nullptr), plainString(plainString_) {};
 
+// Copies share the parsed tree of the copied expression.
 Expression::Expression(const Expression& copy)
-    : node(nullptr), plainString{copy.plainString} {};
+    : node(std::atomic_load(&copy.node)), plainString{copy.plainString} {};
 
 Expression& Expression::operator=(const Expression& expression) {
+  if (this == &expression) return *this;
+
   plainString = expression.plainString;
-  node = nullptr;
+  std::atomic_store(&node, std::atomic_load(&expression.node));
+  isNodeUnshared = false;
   return *this;
 };
 
 Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
-  if (!node) {
-    gd::ExpressionParser2 parser = ExpressionParser2();
-    node = std::move(parser.ParseExpression(plainString));
-  }
-  return node.get();
+  std::shared_ptr<gd::ExpressionNode> currentNode = std::atomic_load(&node);
+  if (currentNode) return currentNode.get();
+
+  std::shared_ptr<gd::ExpressionNode> parsedNode =
+      gd::ParsedExpressionsCache::Get().GetOrParse(plainString);
+
+  // Another thread may have parsed the expression at the same time: keep
+  // the first tree, so that the returned one stays alive.
+  if (std::atomic_compare_exchange_strong(&node, &currentNode, parsedNode))
+    return parsedNode.get();
+  return currentNode.get();
+}
+
+ExpressionNode* Expression::GetUnsharedRootNode() const {
+  // A tree parsed by this method is not in the cache, but can still have been
+  // shared with a copy of this expression.
+  std::shared_ptr<gd::ExpressionNode> currentNode = std::atomic_load(&node);
+  if (currentNode && isNodeUnshared && currentNode.use_count() == 2)
+    return currentNode.get();
+
+  std::shared_ptr<gd::ExpressionNode> parsedNode =
+      gd::ParsedExpressionsCache::Parse(plainString);
+  std::atomic_store(&node, parsedNode);
+  isNodeUnshared = true;
+  return parsedNode.get();
 }
 
 }  // namespace gd
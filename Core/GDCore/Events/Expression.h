@@ -61,10 +61,21 @@ class GD_CORE_API Expression {
 
   /**
    * @brief Get the expression node.
-   * @return std::unique_ptr<gd::ExpressionNode>
+   *
+   * The tree is parsed the first time it's needed. It can be shared with the
+   * copies of this expression and with the other expressions having the same
+   * string (see gd::ParsedExpressionsCache), so it must not be modified: use
+   * GetUnsharedRootNode to modify it.
    */
   gd::ExpressionNode* GetRootNode() const;
 
+  /**
+   * @brief Get the expression node, owned only by this expression so that it
+   * can be modified (for example before being printed back to a string to
+   * rename something).
+   */
+  gd::ExpressionNode* GetUnsharedRootNode() const;
+
   /**
    * \brief Mimics std::string::c_str
    */
@@ -74,7 +85,11 @@ class GD_CORE_API Expression {
 
  private:
   gd::String plainString;  ///< The expression string
-  mutable std::unique_ptr<gd::ExpressionNode> node;
+  // The parsed expression (can be shared, and read or set by multiple
+  // threads, so always accessed with atomic operations).
+  mutable std::shared_ptr<gd::ExpressionNode> node;
+  mutable bool isNodeUnshared = false;  ///< true if the node was parsed by
+                                        ///< GetUnsharedRootNode.
 };
 
 }  // namespace gd
@@ -0,0 +1,95 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+
+namespace gd {
+
+std::atomic<ParsedExpressionsCache*> ParsedExpressionsCache::singleton{
+    nullptr};
+std::mutex ParsedExpressionsCache::singletonMutex;
+
+std::shared_ptr<gd::ExpressionNode> ParsedExpressionsCache::GetOrParse(
+    const gd::String& expression) {
+  if (!enabled) return Parse(expression);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = trees.find(expression);
+    if (it != trees.end()) {
+      std::shared_ptr<gd::ExpressionNode> tree = it->second.lock();
+      if (tree) {
+        hitsCount++;
+        return tree;
+      }
+    }
+  }
+
+  // Parse without holding the lock, so that other threads can use the cache.
+  std::shared_ptr<gd::ExpressionNode> tree = Parse(expression);
+  missesCount++;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::weak_ptr<gd::ExpressionNode>& cachedTree = trees[expression];
+  std::shared_ptr<gd::ExpressionNode> existingTree = cachedTree.lock();
+  if (existingTree) return existingTree;  // Parsed by another thread.
+
+  cachedTree = tree;
+  if (trees.size() >= removeExpiredTreesThreshold) RemoveExpiredTrees();
+
+  return tree;
+}
+
+std::shared_ptr<gd::ExpressionNode> ParsedExpressionsCache::Parse(
+    const gd::String& expression) {
+  gd::ExpressionParser2 parser;
+  return std::shared_ptr<gd::ExpressionNode>(
+      parser.ParseExpression(expression).release());
+}
+
+void ParsedExpressionsCache::RemoveExpiredTrees() {
+  for (auto it = trees.begin(); it != trees.end();) {
+    if (it->second.expired())
+      it = trees.erase(it);
+    else
+      ++it;
+  }
+
+  // Avoid going through all the entries again before the cache grows.
+  removeExpiredTreesThreshold = std::max<std::size_t>(1024, trees.size() * 2);
+}
+
+void ParsedExpressionsCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  trees.clear();
+  removeExpiredTreesThreshold = 1024;
+}
+
+ParsedExpressionsCache& ParsedExpressionsCache::Get() {
+  // Expressions can be parsed by the threads generating events code.
+  ParsedExpressionsCache* instance = singleton;
+  if (!instance) {
+    std::lock_guard<std::mutex> lock(singletonMutex);
+    if (!singleton) singleton = new ParsedExpressionsCache;
+    instance = singleton;
+  }
+
+  return *instance;
+}
+
+void ParsedExpressionsCache::DestroySingleton() {
+  std::lock_guard<std::mutex> lock(singletonMutex);
+  if (singleton) {
+    delete singleton.load();
+    singleton = nullptr;
+  }
+}
+
+}  // namespace gd
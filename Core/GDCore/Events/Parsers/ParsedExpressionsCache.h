@@ -0,0 +1,109 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "GDCore/String.h"
+
+namespace gd {
+struct ExpressionNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Share the trees of the parsed expressions between the expressions
+ * having the same string.
+ *
+ * Only the trees still used by a gd::Expression are kept: once all the
+ * expressions using a tree are destroyed or changed, the tree is destroyed.
+ * Shared trees must not be modified (see
+ * gd::Expression::GetUnsharedRootNode).
+ *
+ * \see gd::Expression::GetRootNode
+ */
+class GD_CORE_API ParsedExpressionsCache {
+ public:
+  /**
+   * \brief Return the tree of the expression, shared with the other
+   * expressions having the same string, or parse it if no other expression
+   * uses it.
+   */
+  std::shared_ptr<gd::ExpressionNode> GetOrParse(const gd::String& expression);
+
+  /**
+   * \brief Parse the expression into a new tree, without using the cache.
+   */
+  static std::shared_ptr<gd::ExpressionNode> Parse(
+      const gd::String& expression);
+
+  /**
+   * \brief Enable or disable the cache (it's enabled by default). When
+   * disabled, each expression is parsed into its own tree (but copies of an
+   * expression still share its tree).
+   */
+  void SetEnabled(bool enable) { enabled = enable; };
+
+  /**
+   * \brief Return true if the cache is enabled.
+   */
+  bool IsEnabled() const { return enabled; };
+
+  /**
+   * \brief Return the number of times a tree was found in the cache.
+   */
+  std::size_t GetHitsCount() const { return hitsCount; };
+
+  /**
+   * \brief Return the number of times an expression had to be parsed by the
+   * cache.
+   */
+  std::size_t GetMissesCount() const { return missesCount; };
+
+  /**
+   * \brief Set the hits and misses counts back to 0.
+   */
+  void ResetCounters() {
+    hitsCount = 0;
+    missesCount = 0;
+  };
+
+  /**
+   * \brief Forget all the trees. They are still used by the expressions
+   * already sharing them.
+   */
+  void Clear();
+
+  static ParsedExpressionsCache& Get();
+  static void DestroySingleton();
+
+ private:
+  ParsedExpressionsCache(){};
+  virtual ~ParsedExpressionsCache(){};
+
+  /**
+   * Remove the entries of the trees that are not used anymore.
+   */
+  void RemoveExpiredTrees();
+
+  std::unordered_map<gd::String, std::weak_ptr<gd::ExpressionNode>> trees;
+  std::size_t removeExpiredTreesThreshold = 1024;  ///< The number of entries
+                                                   ///< from which expired
+                                                   ///< ones are removed.
+  std::mutex mutex;
+  std::atomic<bool> enabled{true};
+  std::atomic<std::size_t> hitsCount{0};
+  std::atomic<std::size_t> missesCount{0};
+
+  static std::atomic<ParsedExpressionsCache*> singleton;
+  static std::mutex singletonMutex;
+};
+
+}  // namespace gd
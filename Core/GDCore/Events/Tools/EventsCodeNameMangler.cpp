@@ -12,6 +12,7 @@ EventsCodeNameMangler *EventsCodeNameMangler::_singleton = nullptr;
 
 const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
     const gd::String &originalObjectName) {
+  std::lock_guard<std::mutex> lock(mangledNamesMutex);
   auto it = mangledObjectNames.find(originalObjectName);
   if (it != mangledObjectNames.end()) {
     return it->second;
@@ -38,6 +39,7 @@ const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
 
 const gd::String& EventsCodeNameMangler::GetExternalEventsFunctionMangledName(
     const gd::String &externalEventsName) {
+  std::lock_guard<std::mutex> lock(mangledNamesMutex);
   auto it = mangledExternalEventsNames.find(externalEventsName);
   if (it != mangledExternalEventsNames.end()) {
     return it->second;
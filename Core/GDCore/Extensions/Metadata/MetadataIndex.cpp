@@ -0,0 +1,93 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
+
+#include <map>
+
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EffectMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Add all the metadata of the map to the entries, without replacing
+ * entries from extensions indexed before (which have the priority).
+ */
+template <class T>
+void IndexAll(MetadataIndex::EntriesMap<T>& entries,
+              const gd::PlatformExtension& extension,
+              const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata) {
+    entries.emplace(it.first,
+                    MetadataIndex::Entry<T>{&extension, &it.second});
+  }
+}
+
+}  // namespace
+
+MetadataIndex::MetadataIndex(
+    const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions) {
+  for (auto& extensionPtr : extensions) {
+    if (!extensionPtr) continue;
+    gd::PlatformExtension& extension = *extensionPtr;
+
+    // Instructions are indexed in the same order as they used to be searched:
+    // free ones, then the ones of objects, then the ones of behaviors.
+    IndexAll(actions, extension, extension.GetAllActions());
+    IndexAll(conditions, extension, extension.GetAllConditions());
+    IndexAll(expressions, extension, extension.GetAllExpressions());
+    IndexAll(strExpressions, extension, extension.GetAllStrExpressions());
+
+    for (const gd::String& objectType : extension.GetExtensionObjectsTypes()) {
+      objects.emplace(
+          objectType,
+          Entry<gd::ObjectMetadata>{&extension,
+                                    &extension.GetObjectMetadata(objectType)});
+      IndexAll(actions, extension, extension.GetAllActionsForObject(objectType));
+      IndexAll(
+          conditions, extension, extension.GetAllConditionsForObject(objectType));
+      IndexAll(objectsExpressions[objectType],
+               extension,
+               extension.GetAllExpressionsForObject(objectType));
+      IndexAll(objectsStrExpressions[objectType],
+               extension,
+               extension.GetAllStrExpressionsForObject(objectType));
+    }
+
+    for (const gd::String& behaviorType : extension.GetBehaviorsTypes()) {
+      behaviors.emplace(behaviorType,
+                        Entry<gd::BehaviorMetadata>{
+                            &extension,
+                            &extension.GetBehaviorMetadata(behaviorType)});
+      IndexAll(
+          actions, extension, extension.GetAllActionsForBehavior(behaviorType));
+      IndexAll(conditions,
+               extension,
+               extension.GetAllConditionsForBehavior(behaviorType));
+      IndexAll(behaviorsExpressions[behaviorType],
+               extension,
+               extension.GetAllExpressionsForBehavior(behaviorType));
+      IndexAll(behaviorsStrExpressions[behaviorType],
+               extension,
+               extension.GetAllStrExpressionsForBehavior(behaviorType));
+    }
+
+    for (const gd::String& effectType : extension.GetExtensionEffectTypes()) {
+      effects.emplace(
+          effectType,
+          Entry<gd::EffectMetadata>{&extension,
+                                    &extension.GetEffectMetadata(effectType)});
+    }
+  }
+}
+
+}  // namespace gd
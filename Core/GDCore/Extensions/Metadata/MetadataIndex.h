@@ -0,0 +1,110 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class PlatformExtension;
+class BehaviorMetadata;
+class ObjectMetadata;
+class EffectMetadata;
+class InstructionMetadata;
+class ExpressionMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index, built from the extensions of a platform, allowing to find
+ * the metadata of an object, behavior, effect, instruction or expression
+ * (and its extension) from its type in constant time.
+ *
+ * When a type is declared by several extensions, the first extension (in the
+ * order of the platform extensions) wins, like a linear search would do.
+ *
+ * \note The index is owned by gd::Platform, which builds it lazily and
+ * invalidates it when an extension is added or removed. Extensions must not
+ * be modified after being added to the platform (or
+ * gd::Platform::InvalidateMetadataIndex must be called).
+ *
+ * \see gd::MetadataProvider
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API MetadataIndex {
+ public:
+  /**
+   * \brief An indexed metadata, with the extension declaring it.
+   */
+  template <class T>
+  struct Entry {
+    const gd::PlatformExtension* extension;
+    const T* metadata;
+  };
+
+  template <class T>
+  using EntriesMap = std::unordered_map<gd::String, Entry<T>>;
+
+  /**
+   * \brief Metadata declared for a specific object or behavior type, indexed
+   * by this type first.
+   */
+  template <class T>
+  using ScopedEntriesMap = std::unordered_map<gd::String, EntriesMap<T>>;
+
+  /**
+   * \brief Build the index from the given extensions.
+   */
+  MetadataIndex(
+      const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions);
+  virtual ~MetadataIndex(){};
+
+  /**
+   * \brief Find an entry in the given map, or return nullptr.
+   */
+  template <class T>
+  static const Entry<T>* Find(const EntriesMap<T>& entries,
+                              const gd::String& type) {
+    auto it = entries.find(type);
+    return it == entries.end() ? nullptr : &it->second;
+  }
+
+  /**
+   * \brief Find an entry in the given map, scoped to an object or behavior
+   * type, or return nullptr.
+   */
+  template <class T>
+  static const Entry<T>* Find(const ScopedEntriesMap<T>& entries,
+                              const gd::String& scopeType,
+                              const gd::String& type) {
+    auto scopeIt = entries.find(scopeType);
+    if (scopeIt == entries.end()) return nullptr;
+
+    return Find(scopeIt->second, type);
+  }
+
+  EntriesMap<gd::BehaviorMetadata> behaviors;
+  EntriesMap<gd::ObjectMetadata> objects;
+  EntriesMap<gd::EffectMetadata> effects;
+
+  /// Actions (free, object and behavior ones).
+  EntriesMap<gd::InstructionMetadata> actions;
+  /// Conditions (free, object and behavior ones).
+  EntriesMap<gd::InstructionMetadata> conditions;
+
+  EntriesMap<gd::ExpressionMetadata> expressions;
+  EntriesMap<gd::ExpressionMetadata> strExpressions;
+  ScopedEntriesMap<gd::ExpressionMetadata> objectsExpressions;
+  ScopedEntriesMap<gd::ExpressionMetadata> objectsStrExpressions;
+  ScopedEntriesMap<gd::ExpressionMetadata> behaviorsExpressions;
+  ScopedEntriesMap<gd::ExpressionMetadata> behaviorsStrExpressions;
+};
+
+}  // namespace gd
@@ -10,6 +10,7 @@
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/EffectMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
@@ -29,16 +30,41 @@ gd::InstructionMetadata MetadataProvider::badInstructionMetadata;
 gd::ExpressionMetadata MetadataProvider::badExpressionMetadata;
 gd::PlatformExtension MetadataProvider::badExtension;
 
+namespace {
+
+template <class T>
+ExtensionAndMetadata<T> ToExtensionAndMetadata(
+    const MetadataIndex::Entry<T>* entry,
+    const gd::PlatformExtension& badExtension,
+    const T& badMetadata) {
+  if (!entry) return ExtensionAndMetadata<T>(badExtension, badMetadata);
+
+  return ExtensionAndMetadata<T>(*entry->extension, *entry->metadata);
+}
+
+/**
+ * Find an expression declared for the given object or behavior type,
+ * then fallback to the ones of the base object or behavior.
+ */
+const MetadataIndex::Entry<ExpressionMetadata>* FindScopedExpression(
+    const MetadataIndex::ScopedEntriesMap<ExpressionMetadata>& entries,
+    const gd::String& scopeType,
+    const gd::String& exprType) {
+  auto entry = MetadataIndex::Find(entries, scopeType, exprType);
+  if (entry) return entry;
+
+  return MetadataIndex::Find(entries, "", exprType);
+}
+
+}  // namespace
+
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    if (extension->HasBehavior(behaviorType))
-      return ExtensionAndMetadata<BehaviorMetadata>(
-          *extension, extension->GetBehaviorMetadata(behaviorType));
-  }
-
-  return ExtensionAndMetadata<BehaviorMetadata>(badExtension, badBehaviorMetadata);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().behaviors, behaviorType),
+      badExtension,
+      badBehaviorMetadata);
 }
 
 const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
@@ -49,16 +75,10 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionObjectsTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == objectType)
-        return ExtensionAndMetadata<ObjectMetadata>(
-            *extension, extension->GetObjectMetadata(objectType));
-    }
-  }
-
-  return ExtensionAndMetadata<ObjectMetadata>(badExtension, badObjectInfo);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().objects, objectType),
+      badExtension,
+      badObjectInfo);
 }
 
 const ObjectMetadata& MetadataProvider::GetObjectMetadata(
@@ -69,16 +89,10 @@ const ObjectMetadata& MetadataProvider::GetObjectMetadata(
 ExtensionAndMetadata<EffectMetadata>
 MetadataProvider::GetExtensionAndEffectMetadata(const gd::Platform& platform,
                                                 gd::String type) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionEffectTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == type)
-        return ExtensionAndMetadata<EffectMetadata>(
-            *extension, extension->GetEffectMetadata(type));
-    }
-  }
-
-  return ExtensionAndMetadata<EffectMetadata>(badExtension, badEffectMetadata);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().effects, type),
+      badExtension,
+      badEffectMetadata);
 }
 
 const EffectMetadata& MetadataProvider::GetEffectMetadata(
@@ -89,34 +103,10 @@ const EffectMetadata& MetadataProvider::GetEffectMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
-    }
-  }
-
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().actions, actionType),
+      badExtension,
+      badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
@@ -127,34 +117,11 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjectsConditions.find(conditionType) != allObjectsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsConditions.find(conditionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
-    }
-  }
-
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().conditions,
+                          conditionType),
+      badExtension,
+      badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
@@ -166,29 +133,12 @@ const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectExpressions =
-          extension->GetAllExpressionsForObject(objectType);
-      if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allObjectExpressions =
-        extension->GetAllExpressionsForObject("");
-    if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return ToExtensionAndMetadata(
+      FindScopedExpression(platform.GetMetadataIndex().objectsExpressions,
+                           objectType,
+                           exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
@@ -200,28 +150,12 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    if (extension->HasBehavior(autoType)) {
-      const auto& allAutoExpressions =
-          extension->GetAllExpressionsForBehavior(autoType);
-      if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allAutoExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allAutoExpressions =
-        extension->GetAllExpressionsForBehavior("");
-    if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allAutoExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return ToExtensionAndMetadata(
+      FindScopedExpression(platform.GetMetadataIndex().behaviorsExpressions,
+                           autoType,
+                           exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
@@ -233,16 +167,10 @@ const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().expressions, exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
@@ -253,30 +181,12 @@ const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectStrExpressions =
-          extension->GetAllStrExpressionsForObject(objectType);
-      if (allObjectStrExpressions.find(exprType) !=
-          allObjectStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allObjectStrExpressions =
-        extension->GetAllStrExpressionsForObject("");
-    if (allObjectStrExpressions.find(exprType) != allObjectStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return ToExtensionAndMetadata(
+      FindScopedExpression(platform.GetMetadataIndex().objectsStrExpressions,
+                           objectType,
+                           exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
@@ -289,30 +199,12 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    if (extension->HasBehavior(autoType)) {
-      const auto& allBehaviorStrExpressions =
-          extension->GetAllStrExpressionsForBehavior(autoType);
-      if (allBehaviorStrExpressions.find(exprType) !=
-          allBehaviorStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allBehaviorStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allBehaviorStrExpressions =
-        extension->GetAllStrExpressionsForBehavior("");
-    if (allBehaviorStrExpressions.find(exprType) !=
-        allBehaviorStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allBehaviorStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return ToExtensionAndMetadata(
+      FindScopedExpression(platform.GetMetadataIndex().behaviorsStrExpressions,
+                           autoType,
+                           exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata&
@@ -327,16 +219,11 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllStrExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return ToExtensionAndMetadata(
+      MetadataIndex::Find(platform.GetMetadataIndex().strExpressions,
+                          exprType),
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
@@ -5,6 +5,7 @@
  */
 #include "Platform.h"
 
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
@@ -37,6 +38,7 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+  InvalidateMetadataIndex();
 
   // Load all creation functions for objects provided by the
   // extension.
@@ -78,6 +80,19 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  InvalidateMetadataIndex();
+}
+
+const gd::MetadataIndex& Platform::GetMetadataIndex() const {
+  if (!metadataIndex)
+    metadataIndex = std::make_shared<const gd::MetadataIndex>(extensionsLoaded);
+
+  return *metadataIndex;
+}
+
+void Platform::InvalidateMetadataIndex() {
+  metadataIndex.reset();
+  metadataRevision++;
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
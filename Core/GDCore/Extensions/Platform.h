@@ -14,6 +14,7 @@
 #include "GDCore/String.h"
 namespace gd {
 class InstructionsMetadataHolder;
+class MetadataIndex;
 class Project;
 class Object;
 class ObjectConfiguration;
@@ -124,6 +125,34 @@ class GD_CORE_API Platform {
    */
   virtual void RemoveExtension(const gd::String& name);
 
+  /**
+   * \brief Get the index allowing to find the metadata of objects, behaviors,
+   * effects, instructions and expressions by their type.
+   *
+   * The index is built the first time it's requested and kept until an
+   * extension is added or removed.
+   *
+   * \see gd::MetadataProvider
+   */
+  const gd::MetadataIndex& GetMetadataIndex() const;
+
+  /**
+   * \brief Discard the metadata index, so that it's rebuilt the next time
+   * it's requested.
+   *
+   * \note Must be called if an extension was modified after being added to
+   * the platform.
+   */
+  void InvalidateMetadataIndex();
+
+  /**
+   * \brief Get a number that changes every time the metadata of the extensions
+   * may have changed (an extension was added, removed or modified).
+   *
+   * Useful to know if something computed from the metadata is still valid.
+   */
+  std::size_t GetMetadataRevision() const { return metadataRevision; }
+
   /**
    * \brief Get the metadata (icon, etc...) of a group used for instructions or
    * expressions.
@@ -173,6 +202,9 @@ class GD_CORE_API Platform {
   std::map<gd::String, InstructionOrExpressionGroupMetadata>
       instructionOrExpressionGroupMetadata;
   static InstructionOrExpressionGroupMetadata badInstructionOrExpressionGroupMetadata;
+  mutable std::shared_ptr<const gd::MetadataIndex>
+      metadataIndex;  ///< Lazily built, see GetMetadataIndex.
+  std::size_t metadataRevision = 0;  ///< See GetMetadataRevision.
   bool enableExtensionLoadingLogs;
 };
 
@@ -18,4 +18,16 @@ gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   return filename.FindAndReplace("\\", "/");
 }
 
+bool AbstractFileSystem::LinkFile(const gd::String& file,
+                                  const gd::String& destination) {
+  return false;
+}
+
+bool AbstractFileSystem::GetFileInfo(const gd::String& file,
+                                     FileInfo& fileInfo) {
+  return false;
+}
+
+bool AbstractFileSystem::SupportsConcurrentAccess() { return false; }
+
 }  // namespace gd
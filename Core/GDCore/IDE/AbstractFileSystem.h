@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <cstdint>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -23,6 +24,22 @@ namespace gd {
  */
 class GD_CORE_API AbstractFileSystem {
  public:
+  /**
+   * \brief Information about a file, used to know if it was modified.
+   */
+  struct FileInfo {
+    uint64_t size = 0;
+    int64_t modificationTime = 0;  ///< In milliseconds, with any origin.
+    gd::String contentHash;  ///< Optional: can be empty if not computed.
+
+    bool operator==(const FileInfo& other) const {
+      return size == other.size &&
+             modificationTime == other.modificationTime &&
+             contentHash == other.contentHash;
+    };
+    bool operator!=(const FileInfo& other) const { return !(*this == other); };
+  };
+
   virtual ~AbstractFileSystem();
 
   /**
@@ -100,6 +117,38 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool CopyFile(const gd::String& file,
                         const gd::String& destination) = 0;
 
+  /**
+   * \brief Make \a destination a copy of \a file without copying its content,
+   * if the file system supports it (for example with a copy-on-write clone).
+   *
+   * The destination must stay unchanged if the source is modified later, so
+   * hard links must not be used.
+   *
+   * \return true if the operation succeeded, false if it's not supported (in
+   * which case CopyFile should be used).
+   * \note The default implementation does nothing and returns false.
+   */
+  virtual bool LinkFile(const gd::String& file,
+                        const gd::String& destination);
+
+  /**
+   * \brief Get the size and the modification time (and optionally a hash of
+   * the content) of a file.
+   *
+   * \return true if the information was retrieved, false if the file does not
+   * exist or if the file system does not support it.
+   * \note The default implementation returns false.
+   */
+  virtual bool GetFileInfo(const gd::String& file, FileInfo& fileInfo);
+
+  /**
+   * \brief Return true if CopyFile, LinkFile and GetFileInfo can be called
+   * from several threads at the same time.
+   *
+   * \note The default implementation returns false.
+   */
+  virtual bool SupportsConcurrentAccess();
+
   /**
    * \brief Write the content of a string to a file.
    * \return true if the operation succeeded.
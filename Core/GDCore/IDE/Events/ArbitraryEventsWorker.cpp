@@ -13,6 +13,7 @@
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
 
@@ -25,13 +26,29 @@ AbstractArbitraryEventsWorker::~AbstractArbitraryEventsWorker() {}
 void AbstractArbitraryEventsWorker::VisitEventList(gd::EventsList& events) {
   DoVisitEventList(events);
 
+  // Only the events of the launched events list are filtered (and indexed).
+  gd::EventsReferencesIndex* index =
+      eventsListsDepth == 0 ? eventsReferencesIndex : nullptr;
+  eventsListsDepth++;
+
   for (std::size_t i = 0; i < events.size();) {
+    if (index) {
+      auto event = events.GetEventSmartPtr(i);
+      if (!index->MayReference(event, eventsReferencesSymbol)) {
+        ++i;
+        continue;
+      }
+      index->InvalidateEvent(*event);
+    }
+
     if (events[i].AcceptVisitor(*this))
       events.RemoveEvent(i);
     else {
       ++i;
     }
   }
+
+  eventsListsDepth--;
 }
 
 bool AbstractArbitraryEventsWorker::VisitEvent(gd::BaseEvent& event) {
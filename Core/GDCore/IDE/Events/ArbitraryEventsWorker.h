@@ -18,6 +18,7 @@ class Instruction;
 class BaseEvent;
 class LinkEvent;
 class EventsList;
+class EventsReferencesIndex;
 class ObjectsContainer;
 class Expression;
 class ParameterMetadata;
@@ -45,12 +46,29 @@ class GD_CORE_API AbstractArbitraryEventsWorker : private EventVisitor {
    */
   void SetSkipDisabledEvents(bool skip) { skipDisabledEvents_ = skip; }
 
+  /**
+   * \brief When set, the events of the launched events lists that can't
+   * reference the symbol (according to the index) are skipped, with their
+   * entire subtree.
+   *
+   * The visited events are invalidated in the index, as they may be modified
+   * by the worker. The index must outlive the launches of the worker.
+   */
+  void SetEventsReferencesFilter(gd::EventsReferencesIndex& index,
+                                 const gd::String& symbol) {
+    eventsReferencesIndex = &index;
+    eventsReferencesSymbol = symbol;
+  }
+
 protected:
   virtual bool VisitEvent(gd::BaseEvent& event) override;
   void VisitEventList(gd::EventsList& events);
 
  private:
   bool skipDisabledEvents_ = false;
+  gd::EventsReferencesIndex* eventsReferencesIndex = nullptr;
+  gd::String eventsReferencesSymbol;
+  std::size_t eventsListsDepth = 0;
   bool VisitLinkEvent(gd::LinkEvent& linkEvent) override;
   void VisitInstructionList(gd::InstructionsList& instructions,
                             bool areConditions);
@@ -122,7 +122,7 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
             }
           }
         } else {
-          auto node = parameterValue.GetRootNode();
+          auto node = parameterValue.GetUnsharedRootNode();
           if (node) {
             ExpressionBehaviorRenamer renamer(objectName,
                                               oldBehaviorName,
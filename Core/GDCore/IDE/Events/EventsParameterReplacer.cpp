@@ -191,7 +191,7 @@ bool EventsParameterReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.GetUnsharedRootNode();
         if (node) {
           ExpressionParameterReplacer renamer(
               platform, GetProjectScopedContainers(),
@@ -215,7 +215,7 @@ bool EventsParameterReplacer::DoVisitEventExpression(
           metadata.GetValueTypeMetadata())) {
     return false;
   }
-  auto node = expression.GetRootNode();
+  auto node = expression.GetUnsharedRootNode();
   if (node) {
     ExpressionParameterReplacer renamer(
         platform, GetProjectScopedContainers(),
@@ -225,7 +225,7 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.GetUnsharedRootNode();
         if (node) {
           ExpressionPropertyReplacer renamer(
               platform, GetProjectScopedContainers(), targetPropertiesContainer,
@@ -251,7 +251,7 @@ bool EventsPropertyReplacer::DoVisitEventExpression(
           metadata.GetValueTypeMetadata())) {
     return false;
   }
-  auto node = expression.GetRootNode();
+  auto node = expression.GetUnsharedRootNode();
   if (node) {
     ExpressionPropertyReplacer renamer(
         platform, GetProjectScopedContainers(), targetPropertiesContainer,
@@ -340,7 +340,7 @@ private:
                   parameterMetadata.GetValueTypeMetadata())) {
             return;
           }
-          auto node = parameterValue.GetRootNode();
+          auto node = parameterValue.GetUnsharedRootNode();
           if (node) {
             ExpressionObjectRenamer renamer(
                 platform, GetProjectScopedContainers(),
@@ -371,7 +371,7 @@ private:
             metadata.GetValueTypeMetadata())) {
       return false;
     }
-    auto node = expression.GetRootNode();
+    auto node = expression.GetUnsharedRootNode();
     if (node) {
       ExpressionObjectRenamer renamer(platform, GetProjectScopedContainers(),
                                       metadata.GetValueTypeMetadata().GetName(),
@@ -402,8 +402,11 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                             gd::EventsList& events,
                                             const gd::ObjectsContainer &targetedObjectsContainer,
                                             gd::String oldName,
-                                            gd::String newName) {
+                                            gd::String newName,
+                                            gd::EventsReferencesIndex* referencesIndex) {
   gd::EventsObjectReplacer eventsParameterReplacer(platform, targetedObjectsContainer, oldName, newName);
+  if (referencesIndex)
+    eventsParameterReplacer.SetEventsReferencesFilter(*referencesIndex, oldName);
   eventsParameterReplacer.Launch(events, projectScopedContainers);
 }
 
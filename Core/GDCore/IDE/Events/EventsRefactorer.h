@@ -20,6 +20,7 @@ class Platform;
 class ExternalEvents;
 class BaseEvent;
 class Instruction;
+class EventsReferencesIndex;
 typedef std::shared_ptr<gd::BaseEvent> BaseEventSPtr;
 }  // namespace gd
 
@@ -79,13 +80,17 @@ class GD_CORE_API EventsRefactorer {
    * Replace all occurrences of an object name by another name
    * ( include : objects in parameters and in math/text expressions of all
    * events ).
+   *
+   * If an index is given, only the events that can reference the object are
+   * browsed.
    */
   static void RenameObjectInEvents(const gd::Platform& platform,
                                    const gd::ProjectScopedContainers& projectScopedContainers,
                                    gd::EventsList& events,
                                    const gd::ObjectsContainer &targetedObjectsContainer,
                                    gd::String oldName,
-                                   gd::String newName);
+                                   gd::String newName,
+                                   gd::EventsReferencesIndex* referencesIndex = nullptr);
 
   /**
    * Search for a gd::String in events
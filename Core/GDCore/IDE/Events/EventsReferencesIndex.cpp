@@ -0,0 +1,88 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+bool IsWordCharacter(unsigned char c) {
+  // Bytes of multi-bytes UTF-8 characters are all considered as letters.
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '_' || c >= 0x80;
+}
+}  // namespace
+
+bool EventsReferencesIndex::MayReference(
+    const std::shared_ptr<gd::BaseEvent>& event, const gd::String& symbol) {
+  std::unordered_set<gd::String> symbolWords;
+  GetWords(symbol, symbolWords);
+  if (symbolWords.empty()) return true;
+
+  const IndexedEvent& indexedEvent = GetIndexedEvent(event);
+  for (const gd::String& word : symbolWords) {
+    if (indexedEvent.words.find(word) == indexedEvent.words.end())
+      return false;
+  }
+
+  return true;
+}
+
+void EventsReferencesIndex::InvalidateEvent(const gd::BaseEvent& event) {
+  indexedEvents.erase(&event);
+}
+
+const EventsReferencesIndex::IndexedEvent&
+EventsReferencesIndex::GetIndexedEvent(
+    const std::shared_ptr<gd::BaseEvent>& event) {
+  auto it = indexedEvents.find(event.get());
+  // An event can have been destroyed and another one created at the same
+  // address since it was indexed.
+  if (it != indexedEvents.end() && it->second.event.lock() == event)
+    return it->second;
+
+  IndexedEvent& indexedEvent = indexedEvents[event.get()];
+  indexedEvent.event = event;
+  indexedEvent.words.clear();
+
+  gd::SerializerElement element;
+  event->SerializeTo(element);
+  GetWords(element, indexedEvent.words);
+
+  return indexedEvent;
+}
+
+void EventsReferencesIndex::GetWords(const gd::String& str,
+                                     std::unordered_set<gd::String>& words) {
+  const std::string& raw = str.Raw();
+  std::size_t wordStart = 0;
+  for (std::size_t i = 0; i <= raw.size(); ++i) {
+    if (i < raw.size() && IsWordCharacter(raw[i])) continue;
+
+    if (i > wordStart)
+      words.insert(gd::String::FromUTF8(raw.substr(wordStart, i - wordStart)));
+    wordStart = i + 1;
+  }
+}
+
+void EventsReferencesIndex::GetWords(const gd::SerializerElement& element,
+                                     std::unordered_set<gd::String>& words) {
+  if (element.GetValue().IsString())
+    GetWords(element.GetValue().GetRawString(), words);
+
+  for (const auto& attribute : element.GetAllAttributes()) {
+    if (attribute.second.IsString())
+      GetWords(attribute.second.GetRawString(), words);
+  }
+
+  for (const auto& child : element.GetAllChildren()) {
+    GetWords(*child.second, words);
+  }
+}
+
+}  // namespace gd
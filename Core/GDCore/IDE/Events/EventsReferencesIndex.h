@@ -0,0 +1,95 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Index the names (of objects, groups, variables, behaviors, functions,
+ * layers...) mentioned by events, so that refactorings only browse the events
+ * that can reference the renamed symbol.
+ *
+ * The index is built lazily: an event is indexed the first time it's
+ * checked, using all the strings of its conditions, actions, expressions and
+ * sub-events. Events browsed by a worker using the index (see
+ * gd::AbstractArbitraryEventsWorker::SetEventsReferencesFilter) are indexed
+ * again when they are checked next, as the worker may have modified them.
+ * Events added to (or removed from) events lists are detected, but **events
+ * modified elsewhere must be invalidated** with InvalidateEvent (or the
+ * whole index with Clear).
+ *
+ * This is a conservative index: an event is said to reference a symbol if all
+ * the words of the symbol are found in the event, even if they are used for
+ * something else.
+ *
+ * \see gd::WholeProjectRefactorer
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsReferencesIndex {
+ public:
+  EventsReferencesIndex(){};
+  virtual ~EventsReferencesIndex(){};
+
+  /**
+   * \brief Return true if the event (or one of its sub-events) can reference
+   * the symbol. Return false only if it's sure that the symbol is not used.
+   */
+  bool MayReference(const std::shared_ptr<gd::BaseEvent>& event,
+                    const gd::String& symbol);
+
+  /**
+   * \brief Forget what is known about the event, to be called after it was
+   * modified.
+   *
+   * \note Only top-level events are indexed: when a sub-event is modified, its
+   * top-level parent event must be invalidated.
+   */
+  void InvalidateEvent(const gd::BaseEvent& event);
+
+  /**
+   * \brief Forget all the indexed events.
+   */
+  void Clear() { indexedEvents.clear(); };
+
+  /**
+   * \brief Return the number of events currently indexed.
+   */
+  std::size_t GetIndexedEventsCount() const { return indexedEvents.size(); };
+
+  /**
+   * \brief Split a string into the words used to index events (the characters
+   * other than letters, digits and underscores are separators).
+   */
+  static void GetWords(const gd::String& str,
+                       std::unordered_set<gd::String>& words);
+
+ private:
+  struct IndexedEvent {
+    std::weak_ptr<gd::BaseEvent> event;
+    std::unordered_set<gd::String> words;
+  };
+
+  const IndexedEvent& GetIndexedEvent(
+      const std::shared_ptr<gd::BaseEvent>& event);
+  static void GetWords(const gd::SerializerElement& element,
+                       std::unordered_set<gd::String>& words);
+
+  std::unordered_map<const gd::BaseEvent*, IndexedEvent> indexedEvents;
+};
+
+}  // namespace gd
@@ -459,7 +459,7 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain variables.
 
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.GetUnsharedRootNode();
         if (node) {
           ExpressionVariableReplacer renamer(platform,
                                              GetProjectScopedContainers(),
@@ -493,7 +493,7 @@ bool EventsVariableReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain variables.
 
-  auto node = expression.GetRootNode();
+  auto node = expression.GetUnsharedRootNode();
   if (node) {
     ExpressionVariableReplacer renamer(platform,
                                        GetProjectScopedContainers(),
@@ -150,7 +150,7 @@ bool ExpressionsParameterMover::DoVisitInstruction(gd::Instruction& instruction,
     const gd::String& type = metadata.parameters.GetParameter(pNb).GetType();
     const gd::Expression& expression = instruction.GetParameter(pNb);
 
-    auto node = expression.GetRootNode();
+    auto node = expression.GetUnsharedRootNode();
     if (node) {
       ExpressionParameterMover mover(GetProjectScopedContainers(),
                                      behaviorType,
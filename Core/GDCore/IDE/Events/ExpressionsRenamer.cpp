@@ -156,7 +156,7 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
        ++pNb) {
     const gd::Expression& expression = instruction.GetParameter(pNb);
 
-    auto node = expression.GetRootNode();
+    auto node = expression.GetUnsharedRootNode();
     if (node) {
       ExpressionFunctionRenamer renamer(GetProjectScopedContainers(),
                                         behaviorType,
@@ -218,6 +218,19 @@ void ArbitraryResourceWorker::ExposeResource(gd::Resource& resource) {
 
 ArbitraryResourceWorker::~ArbitraryResourceWorker() {}
 
+namespace {
+/**
+ * Update a parameter only if the worker changed its value, so that the
+ * instruction (and its parsed expressions) is left untouched otherwise.
+ */
+void SetParameterIfChanged(gd::Instruction &instruction,
+                           size_t parameterIndex,
+                           const gd::String &value,
+                           const gd::String &updatedValue) {
+  if (updatedValue != value) instruction.SetParameter(parameterIndex, updatedValue);
+}
+}  // namespace
+
 bool ResourceWorkerInEventsWorker::DoVisitInstruction(gd::Instruction& instruction, bool isCondition) {
   const auto& platform = project.GetCurrentPlatform();
   const auto& metadata = isCondition
@@ -256,47 +269,57 @@ bool ResourceWorkerInEventsWorker::DoVisitInstruction(gd::Instruction& instructi
         if (parameterMetadata.GetType() == "fontResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeFont(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "soundfile" ||
                     parameterMetadata.GetType() ==
                         "musicfile") {  // Should be renamed audioResource
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeAudio(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "bitmapFontResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeBitmapFont(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "imageResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeImage(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "jsonResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeJson(updatedParameterValue);
           worker.ExposeEmbeddeds(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "tilemapResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeTilemap(updatedParameterValue);
           worker.ExposeEmbeddeds(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "tilesetResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeTileset(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "model3DResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeModel3D(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "atlasResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeAtlas(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         } else if (parameterMetadata.GetType() == "spineResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeSpine(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          SetParameterIfChanged(instruction, parameterIndex, parameterValue,
+                                updatedParameterValue);
         }
       });
 
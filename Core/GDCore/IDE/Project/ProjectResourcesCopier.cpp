@@ -4,36 +4,152 @@
  * reserved. This project is released under the MIT License.
  */
 #include "ProjectResourcesCopier.h"
+#include <cstdio>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/ParallelFor.h"
 #include "GDCore/IDE/ResourceExposer.h"
 
 using namespace std;
 
 namespace gd {
 
+namespace {
+
+/**
+ * \brief A file copied by a previous copy, with the information about its
+ * source and its destination when it was copied.
+ */
+struct CopiedFile {
+  gd::String source;
+  gd::AbstractFileSystem::FileInfo sourceInfo;
+  gd::AbstractFileSystem::FileInfo destinationInfo;
+};
+
+/**
+ * \brief A file to be copied, and the result of its copy.
+ */
+struct FileToCopy {
+  enum Status { NotCopied, Copied, Unchanged, Failed };
+
+  gd::String destination;
+  CopiedFile copiedFile;
+  Status status = NotCopied;
+  bool hasInfo = false;  ///< True if copiedFile infos are filled.
+};
+
+/**
+ * \brief Return the file used to store the files copied to a destination
+ * directory. It's not stored in the destination, which is exported.
+ */
+gd::String GetManifestFile(gd::AbstractFileSystem& fs,
+                           const gd::String& destinationDirectory) {
+  // FNV-1a hash of the directory, used as the name of its manifest.
+  uint64_t hash = UINT64_C(14695981039346656037);
+  for (char byte : destinationDirectory.Raw()) {
+    hash ^= static_cast<unsigned char>(byte);
+    hash *= UINT64_C(1099511628211);
+  }
+  char hashString[17];
+  std::snprintf(
+      hashString, sizeof(hashString), "%016llx", (unsigned long long)hash);
+
+  return fs.GetTempDir() + "/ResourcesCopies/" + hashString + ".json";
+}
+
+void SerializeFileInfo(const gd::AbstractFileSystem::FileInfo& fileInfo,
+                       gd::SerializerElement& element) {
+  // Sizes and times don't fit in the integers of gd::SerializerElement.
+  element.SetAttribute("size", gd::String::From(fileInfo.size));
+  element.SetAttribute("modificationTime",
+                       gd::String::From(fileInfo.modificationTime));
+  element.SetAttribute("contentHash", fileInfo.contentHash);
+}
+
+void UnserializeFileInfo(gd::AbstractFileSystem::FileInfo& fileInfo,
+                         const gd::SerializerElement& element) {
+  gd::String size = element.GetStringAttribute("size");
+  gd::String modificationTime = element.GetStringAttribute("modificationTime");
+  fileInfo.size = size.empty() ? 0 : size.To<uint64_t>();
+  fileInfo.modificationTime =
+      modificationTime.empty() ? 0 : modificationTime.To<int64_t>();
+  fileInfo.contentHash = element.GetStringAttribute("contentHash");
+}
+
+std::unordered_map<gd::String, CopiedFile> ReadManifest(
+    gd::AbstractFileSystem& fs, const gd::String& manifestFile) {
+  std::unordered_map<gd::String, CopiedFile> copiedFiles;
+  if (!fs.FileExists(manifestFile)) return copiedFiles;
+
+  gd::SerializerElement manifestElement =
+      gd::Serializer::FromJSON(fs.ReadFile(manifestFile));
+  if (manifestElement.GetIntAttribute("version") != 1) return copiedFiles;
+
+  gd::SerializerElement& filesElement = manifestElement.GetChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (std::size_t i = 0; i < filesElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& fileElement = filesElement.GetChild(i);
+    CopiedFile& copiedFile =
+        copiedFiles[fileElement.GetStringAttribute("destination")];
+    copiedFile.source = fileElement.GetStringAttribute("source");
+    UnserializeFileInfo(copiedFile.sourceInfo,
+                        fileElement.GetChild("sourceInfo"));
+    UnserializeFileInfo(copiedFile.destinationInfo,
+                        fileElement.GetChild("destinationInfo"));
+  }
+
+  return copiedFiles;
+}
+
+void WriteManifest(gd::AbstractFileSystem& fs,
+                   const gd::String& manifestFile,
+                   const std::vector<FileToCopy>& filesToCopy) {
+  gd::SerializerElement manifestElement;
+  manifestElement.SetAttribute("version", 1);
+  gd::SerializerElement& filesElement = manifestElement.AddChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (const FileToCopy& fileToCopy : filesToCopy) {
+    if (!fileToCopy.hasInfo) continue;
+
+    gd::SerializerElement& fileElement = filesElement.AddChild("file");
+    fileElement.SetAttribute("destination", fileToCopy.destination);
+    fileElement.SetAttribute("source", fileToCopy.copiedFile.source);
+    SerializeFileInfo(fileToCopy.copiedFile.sourceInfo,
+                      fileElement.AddChild("sourceInfo"));
+    SerializeFileInfo(fileToCopy.copiedFile.destinationInfo,
+                      fileElement.AddChild("destinationInfo"));
+  }
+
+  gd::String manifestDirectory = fs.DirNameFrom(manifestFile);
+  if (!fs.DirExists(manifestDirectory)) fs.MkDir(manifestDirectory);
+  fs.WriteToFile(manifestFile, gd::Serializer::ToJSON(manifestElement));
+}
+
+}  // namespace
+
 bool ProjectResourcesCopier::CopyAllResourcesTo(
     gd::Project& originalProject,
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool updateOriginalProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
-  if (updateOriginalProject) {
-    gd::ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
-        originalProject, fs, destinationDirectory, preserveAbsoluteFilenames,
-        preserveDirectoryStructure);
-  } else {
-    gd::Project clonedProject = originalProject;
-    gd::ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
-        clonedProject, fs, destinationDirectory, preserveAbsoluteFilenames,
-        preserveDirectoryStructure);
-  }
+    bool preserveDirectoryStructure,
+    std::size_t threadsCount) {
+  // When the original project must not be updated, the new filenames are
+  // only computed: there is no need to copy the whole project.
+  gd::ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
+      originalProject, fs, destinationDirectory, updateOriginalProject,
+      preserveAbsoluteFilenames, preserveDirectoryStructure, threadsCount);
   return true;
 }
 
@@ -41,8 +157,10 @@ bool ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
     gd::Project& project,
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
+    bool updateProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    std::size_t threadsCount) {
 
   auto projectDirectory = fs.DirNameFrom(project.GetProjectFile());
   std::cout << "Copying all resources from " << projectDirectory << " to "
@@ -55,31 +173,93 @@ bool ProjectResourcesCopier::AdaptFilePathsAndCopyAllResourcesTo(
   resourcesMergingHelper.PreserveDirectoriesStructure(
       preserveDirectoryStructure);
   resourcesMergingHelper.PreserveAbsoluteFilenames(preserveAbsoluteFilenames);
+  resourcesMergingHelper.SetShouldUpdateFilenames(updateProject);
   gd::ResourceExposer::ExposeWholeProjectResources(project,
                                                     resourcesMergingHelper);
 
-  // Copy resources
+  // List the files to copy, creating each destination directory only once.
   map<gd::String, gd::String>& resourcesNewFilename =
       resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
-  for (map<gd::String, gd::String>::const_iterator it =
-           resourcesNewFilename.begin();
-       it != resourcesNewFilename.end();
-       ++it) {
-    if (!it->first.empty()) {
-      // Create the destination filename
-      gd::String destinationFile = it->second;
-      fs.MakeAbsolute(destinationFile, destinationDirectory);
-
-      // Be sure the directory exists
-      gd::String dir = fs.DirNameFrom(destinationFile);
-      if (!fs.DirExists(dir)) fs.MkDir(dir);
-
-      // We can now copy the file
-      if (!fs.CopyFile(it->first, destinationFile)) {
-        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
-                       destinationFile + _("\"."));
+  std::vector<FileToCopy> filesToCopy;
+  filesToCopy.reserve(resourcesNewFilename.size());
+  std::unordered_set<gd::String> checkedDirectories;
+  for (const auto& resourceNewFilename : resourcesNewFilename) {
+    if (resourceNewFilename.first.empty()) continue;
+
+    // Create the destination filename
+    FileToCopy fileToCopy;
+    fileToCopy.copiedFile.source = resourceNewFilename.first;
+    fileToCopy.destination = resourceNewFilename.second;
+    fs.MakeAbsolute(fileToCopy.destination, destinationDirectory);
+
+    // Be sure the directory exists
+    gd::String dir = fs.DirNameFrom(fileToCopy.destination);
+    if (checkedDirectories.insert(dir).second && !fs.DirExists(dir))
+      fs.MkDir(dir);
+
+    filesToCopy.push_back(std::move(fileToCopy));
+  }
+
+  // Files which were not modified (in the source and in the destination)
+  // since they were copied by the last copy are not copied again.
+  gd::String manifestFile = GetManifestFile(fs, destinationDirectory);
+  const std::unordered_map<gd::String, CopiedFile> previouslyCopiedFiles =
+      ReadManifest(fs, manifestFile);
+
+  auto copyFile = [&fs, &filesToCopy, &previouslyCopiedFiles](
+                      std::size_t index) {
+    FileToCopy& fileToCopy = filesToCopy[index];
+    CopiedFile& copiedFile = fileToCopy.copiedFile;
+    bool hasSourceInfo =
+        fs.GetFileInfo(copiedFile.source, copiedFile.sourceInfo);
+    if (hasSourceInfo) {
+      auto previouslyCopiedFile =
+          previouslyCopiedFiles.find(fileToCopy.destination);
+      if (previouslyCopiedFile != previouslyCopiedFiles.end() &&
+          previouslyCopiedFile->second.source == copiedFile.source &&
+          previouslyCopiedFile->second.sourceInfo == copiedFile.sourceInfo &&
+          fs.GetFileInfo(fileToCopy.destination, copiedFile.destinationInfo) &&
+          previouslyCopiedFile->second.destinationInfo ==
+              copiedFile.destinationInfo) {
+        fileToCopy.status = FileToCopy::Unchanged;
+        fileToCopy.hasInfo = true;
+        return;
       }
     }
+
+    // We can now copy the file, without copying its content if possible.
+    if (!fs.LinkFile(copiedFile.source, fileToCopy.destination) &&
+        !fs.CopyFile(copiedFile.source, fileToCopy.destination)) {
+      fileToCopy.status = FileToCopy::Failed;
+      return;
+    }
+
+    fileToCopy.status = FileToCopy::Copied;
+    fileToCopy.hasInfo =
+        hasSourceInfo &&
+        fs.GetFileInfo(fileToCopy.destination, copiedFile.destinationInfo);
+  };
+  gd::ParallelFor(filesToCopy.size(),
+                  fs.SupportsConcurrentAccess() ? threadsCount : 1,
+                  copyFile);
+
+  std::size_t unchangedFilesCount = 0;
+  bool hasInfo = false;
+  for (const FileToCopy& fileToCopy : filesToCopy) {
+    if (fileToCopy.status == FileToCopy::Failed) {
+      gd::LogWarning(_("Unable to copy \"") + fileToCopy.copiedFile.source +
+                     _("\" to \"") + fileToCopy.destination + _("\"."));
+    } else if (fileToCopy.status == FileToCopy::Unchanged) {
+      unchangedFilesCount++;
+    }
+    hasInfo = hasInfo || fileToCopy.hasInfo;
+  }
+  if (hasInfo || !previouslyCopiedFiles.empty())
+    WriteManifest(fs, manifestFile, filesToCopy);
+
+  if (unchangedFilesCount > 0) {
+    std::cout << unchangedFilesCount
+              << " unchanged files were not copied again." << std::endl;
   }
 
   return true;
@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <cstddef>
+
 #include "GDCore/String.h"
 
 namespace gd {
@@ -17,6 +19,12 @@ namespace gd {
 /**
  * \brief Copy all resources files of a project to a directory.
  *
+ * If the file system can give information about files (see
+ * gd::AbstractFileSystem::GetFileInfo), the copied files are remembered in a
+ * manifest stored in the temporary directory, so that the files which are
+ * unchanged in the source and in the destination are not copied again by
+ * the next copy to the same directory.
+ *
  * \ingroup IDE
  */
 class GD_CORE_API ProjectResourcesCopier {
@@ -40,6 +48,10 @@ class GD_CORE_API ProjectResourcesCopier {
    * of the resources will be preserved when copying. Otherwise, everything will
    * be send in the destinationDirectory.
    *
+   * \param threadsCount The maximum number of files copied at the same time.
+   * Only used if the file system supports concurrent accesses (see
+   * gd::AbstractFileSystem::SupportsConcurrentAccess).
+   *
    * \return true if no error happened
    */
   static bool CopyAllResourcesTo(gd::Project& project,
@@ -47,13 +59,15 @@ class GD_CORE_API ProjectResourcesCopier {
                                  gd::String destinationDirectory,
                                  bool updateOriginalProject,
                                  bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveDirectoryStructure = true,
+                                 std::size_t threadsCount = 1);
 
 private:
   static bool AdaptFilePathsAndCopyAllResourcesTo(
       gd::Project &project, gd::AbstractFileSystem &fs,
-      gd::String destinationDirectory, bool preserveAbsoluteFilenames = true,
-      bool preserveDirectoryStructure = true);
+      gd::String destinationDirectory, bool updateProject,
+      bool preserveAbsoluteFilenames = true,
+      bool preserveDirectoryStructure = true, std::size_t threadsCount = 1);
 };
 
 }  // namespace gd
@@ -16,6 +16,17 @@
 namespace gd {
 
 void ResourcesMergingHelper::ExposeFile(gd::String& resourceFilename) {
+  if (!shouldUpdateFilenames) {
+    // Work on a copy, so that only newFilenames is filled.
+    gd::String newResourceFilename = resourceFilename;
+    UpdateFilename(newResourceFilename);
+    return;
+  }
+
+  UpdateFilename(resourceFilename);
+}
+
+void ResourcesMergingHelper::UpdateFilename(gd::String& resourceFilename) {
   if (resourceFilename.empty()) return;
 
   gd::String resourceFullFilename = resourceFilename;
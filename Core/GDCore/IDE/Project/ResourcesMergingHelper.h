@@ -22,6 +22,9 @@ namespace gd {
  * in a single directory (potentially changing the filename to avoid conflicts,
  * but preserving extensions).
  *
+ * By default, the filenames exposed to the helper are updated with the new
+ * filenames. See SetShouldUpdateFilenames to only compute them.
+ *
  * \see ArbitraryResourceWorker
  *
  * \ingroup IDE
@@ -66,6 +69,18 @@ public:
     shouldUseOriginalAbsoluteFilenames = shouldUseOriginalAbsoluteFilenames_;
   };
 
+  /**
+   * \brief Set if the exposed filenames must be updated with the new
+   * filenames (true by default).
+   *
+   * If set to false, the new filenames are only computed (see
+   * GetAllResourcesOldAndNewFilename) and the exposed project is left
+   * untouched, so that it does not need to be copied before.
+   */
+  void SetShouldUpdateFilenames(bool shouldUpdateFilenames_ = true) {
+    shouldUpdateFilenames = shouldUpdateFilenames_;
+  };
+
   /**
    * \brief Return a map containing the resources old absolute filename as key,
    * and the resources new filenames as value. The new filenames are relative to
@@ -82,6 +97,12 @@ public:
   void ExposeFile(gd::String& resource) override;
 
  protected:
+  /**
+   * \brief Compute the new filename of a resource file, and update
+   * \a resourceFilename with it.
+   */
+  void UpdateFilename(gd::String& resourceFilename);
+
   void SetNewFilename(gd::String oldFilename, gd::String newFilename);
 
   /**
@@ -106,6 +127,11 @@ public:
    * any resource.
    */
   bool shouldUseOriginalAbsoluteFilenames = false;
+  /**
+   * Set to false if the new filenames must only be computed, without updating
+   * the exposed filenames.
+   */
+  bool shouldUpdateFilenames = true;
   gd::AbstractFileSystem&
       fs;  ///< The gd::AbstractFileSystem used to manipulate files.
 };
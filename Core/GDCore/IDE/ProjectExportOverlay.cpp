@@ -0,0 +1,267 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectExportOverlay.h"
+
+#include <algorithm>
+#include <set>
+
+#include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/ResourceExposer.h"
+#include "GDCore/IDE/WholeProjectBrowser.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsContainer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/NamedPropertyDescriptor.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesContainer.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Find if a file is referenced directly (without a resource) by the events or
+ * the objects.
+ */
+class FileReferencesFinder : public gd::ArbitraryResourceWorker {
+ public:
+  FileReferencesFinder(gd::ResourcesContainer& resourcesContainer)
+      : gd::ArbitraryResourceWorker(resourcesContainer){};
+  virtual ~FileReferencesFinder(){};
+
+  void ExposeFile(gd::String& resourceFileName) override {
+    if (!resourceFileName.empty()) hasFileReferences = true;
+  };
+
+  bool hasFileReferences = false;
+};
+
+/**
+ * Clear the default flag of the behaviors, remembering which ones had it.
+ */
+class BehaviorDefaultFlagRecorder : public gd::ArbitraryObjectsWorker {
+ public:
+  BehaviorDefaultFlagRecorder(std::vector<gd::Behavior*>& defaultBehaviors_)
+      : defaultBehaviors(defaultBehaviors_){};
+  virtual ~BehaviorDefaultFlagRecorder(){};
+
+ private:
+  void DoVisitBehavior(gd::Behavior& behavior) override {
+    if (!behavior.IsDefaultBehavior()) return;
+
+    defaultBehaviors.push_back(&behavior);
+    behavior.SetDefaultBehavior(false);
+  };
+
+  std::vector<gd::Behavior*>& defaultBehaviors;
+};
+
+}  // namespace
+
+bool ProjectExportOverlay::CanBeUsedOn(gd::Project& project) {
+  FileReferencesFinder fileReferencesFinder(project.GetResourcesManager());
+  gd::ResourceExposer::ExposeWholeProjectResourcesReferences(
+      project, fileReferencesFinder);
+
+  return !fileReferencesFinder.hasFileReferences;
+}
+
+ProjectExportOverlay::ProjectExportOverlay(gd::Project& project_)
+    : project(project_) {}
+
+ProjectExportOverlay::~ProjectExportOverlay() {
+  if (stripped) RestoreStrippedProject();
+  if (resourcesAndPropertiesPreserved) RestoreResourcesAndProperties();
+}
+
+void ProjectExportOverlay::PreserveResourcesAndProperties() {
+  if (resourcesAndPropertiesPreserved) return;
+  resourcesAndPropertiesPreserved = true;
+
+  auto& resourcesContainer = project.GetResourcesManager();
+  for (const gd::String& name : resourcesContainer.GetAllResourceNames()) {
+    gd::Resource& resource = resourcesContainer.GetResource(name);
+    preservedResources.push_back(
+        PreservedResource{&resource, resource.GetFile(), resource.GetMetadata()});
+  }
+
+  platformSpecificAssets = project.GetPlatformSpecificAssets();
+  loadingScreen = project.GetLoadingScreen();
+  watermark = project.GetWatermark();
+  authorIds = project.GetAuthorIds();
+  authorUsernames = project.GetAuthorUsernames();
+}
+
+void ProjectExportOverlay::RestoreResourcesAndProperties() {
+  auto& resourcesContainer = project.GetResourcesManager();
+  std::set<gd::String> preservedNames;
+  for (auto& preservedResource : preservedResources) {
+    gd::Resource& resource = *preservedResource.resource;
+    preservedNames.insert(resource.GetName());
+    if (resource.GetFile() != preservedResource.file)
+      resource.SetFile(preservedResource.file);
+    if (resource.GetMetadata() != preservedResource.metadata)
+      resource.SetMetadata(preservedResource.metadata);
+  }
+  for (const gd::String& name : resourcesContainer.GetAllResourceNames()) {
+    if (preservedNames.find(name) == preservedNames.end())
+      resourcesContainer.RemoveResource(name);
+  }
+
+  project.GetPlatformSpecificAssets() = platformSpecificAssets;
+  project.GetLoadingScreen() = loadingScreen;
+  project.GetWatermark() = watermark;
+  project.GetAuthorIds() = authorIds;
+  project.GetAuthorUsernames() = authorUsernames;
+}
+
+void ProjectExportOverlay::StripProjectForExport() {
+  if (stripped) return;
+  stripped = true;
+
+  objectGroups = project.GetObjects().GetObjectGroups();
+  project.GetObjects().GetObjectGroups().Clear();
+  externalEvents.swap(project.externalEvents);
+
+  tests = project.GetTests();
+  project.GetTests().ClearTests();
+
+  BehaviorDefaultFlagRecorder behaviorDefaultFlagRecorder(defaultBehaviors);
+  gd::WholeProjectBrowser wholeProjectBrowser;
+  wholeProjectBrowser.ExposeObjects(project, behaviorDefaultFlagRecorder);
+
+  layoutsEvents.resize(project.GetLayoutsCount());
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    project.GetLayout(i).GetEvents().Swap(layoutsEvents[i]);
+  }
+
+  // Keep (like gd::ProjectStripper):
+  // - the EventsBasedObject object list because it's useful for the Runtime
+  // to create the child-object.
+  // - the globalVariables and sceneVariables
+  auto& extensions = project.eventsFunctionsExtensions;
+  for (std::size_t i = 0; i < extensions.size(); ++i) {
+    auto& extension = *extensions[i];
+    auto& eventsBasedObjects = extension.GetEventsBasedObjects();
+    if (eventsBasedObjects.size() == 0 &&
+        extension.GetGlobalVariables().Count() == 0 &&
+        extension.GetSceneVariables().Count() == 0) {
+      removedExtensions.emplace_back(i, std::move(extensions[i]));
+      continue;
+    }
+
+    strippedExtensions.emplace_back();
+    auto& strippedExtension = strippedExtensions.back();
+    strippedExtension.extension = &extension;
+    strippedExtension.fullName = extension.GetFullName();
+    strippedExtension.shortDescription = extension.GetShortDescription();
+    strippedExtension.description = extension.GetDescription();
+    strippedExtension.helpPath = extension.GetHelpPath();
+    strippedExtension.iconUrl = extension.GetIconUrl();
+    strippedExtension.previewIconUrl = extension.GetPreviewIconUrl();
+    strippedExtension.originName = extension.GetOriginName();
+    strippedExtension.originIdentifier = extension.GetOriginIdentifier();
+    strippedExtension.version = extension.GetVersion();
+    extension.SetFullName("");
+    extension.SetShortDescription("");
+    extension.SetDescription("");
+    extension.SetHelpPath("");
+    extension.SetIconUrl("");
+    extension.SetPreviewIconUrl("");
+    extension.SetOrigin("", "");
+    extension.SetVersion("");
+
+    for (auto& eventsBasedObject : eventsBasedObjects.GetInternalVector()) {
+      strippedExtension.eventsBasedObjects.emplace_back();
+      auto& strippedEventsBasedObject =
+          strippedExtension.eventsBasedObjects.back();
+      strippedEventsBasedObject.eventsBasedObject = eventsBasedObject.get();
+      strippedEventsBasedObject.fullName = eventsBasedObject->GetFullName();
+      strippedEventsBasedObject.description =
+          eventsBasedObject->GetDescription();
+      eventsBasedObject->SetFullName("");
+      eventsBasedObject->SetDescription("");
+      strippedEventsBasedObject.eventsFunctions.swap(
+          eventsBasedObject->GetEventsFunctions().GetInternalVector());
+      strippedEventsBasedObject.propertyDescriptors.swap(
+          eventsBasedObject->GetPropertyDescriptors().GetInternalVector());
+    }
+    strippedExtension.eventsBasedBehaviors.swap(
+        extension.GetEventsBasedBehaviors().GetInternalVector());
+    strippedExtension.eventsFunctions.swap(
+        extension.GetEventsFunctions().GetInternalVector());
+    strippedExtension.tests = extension.GetTests();
+    extension.GetTests().ClearTests();
+  }
+  extensions.erase(
+      std::remove(extensions.begin(), extensions.end(), nullptr),
+      extensions.end());
+}
+
+void ProjectExportOverlay::RestoreStrippedProject() {
+  auto& extensions = project.eventsFunctionsExtensions;
+  for (auto& strippedExtension : strippedExtensions) {
+    auto& extension = *strippedExtension.extension;
+    extension.SetFullName(strippedExtension.fullName);
+    extension.SetShortDescription(strippedExtension.shortDescription);
+    extension.SetDescription(strippedExtension.description);
+    extension.SetHelpPath(strippedExtension.helpPath);
+    extension.SetIconUrl(strippedExtension.iconUrl);
+    extension.SetPreviewIconUrl(strippedExtension.previewIconUrl);
+    extension.SetOrigin(strippedExtension.originName,
+                        strippedExtension.originIdentifier);
+    extension.SetVersion(strippedExtension.version);
+
+    for (auto& strippedEventsBasedObject :
+         strippedExtension.eventsBasedObjects) {
+      auto& eventsBasedObject = *strippedEventsBasedObject.eventsBasedObject;
+      eventsBasedObject.SetFullName(strippedEventsBasedObject.fullName);
+      eventsBasedObject.SetDescription(strippedEventsBasedObject.description);
+      eventsBasedObject.GetEventsFunctions().GetInternalVector().swap(
+          strippedEventsBasedObject.eventsFunctions);
+      eventsBasedObject.GetPropertyDescriptors().GetInternalVector().swap(
+          strippedEventsBasedObject.propertyDescriptors);
+    }
+    extension.GetEventsBasedBehaviors().GetInternalVector().swap(
+        strippedExtension.eventsBasedBehaviors);
+    extension.GetEventsFunctions().GetInternalVector().swap(
+        strippedExtension.eventsFunctions);
+    extension.GetTests() = strippedExtension.tests;
+  }
+  strippedExtensions.clear();
+
+  // Extensions are reinserted by increasing position, so that each one goes
+  // back to its original position.
+  for (auto& removedExtension : removedExtensions) {
+    extensions.insert(extensions.begin() + removedExtension.first,
+                      std::move(removedExtension.second));
+  }
+  removedExtensions.clear();
+
+  for (std::size_t i = 0;
+       i < project.GetLayoutsCount() && i < layoutsEvents.size();
+       ++i) {
+    project.GetLayout(i).GetEvents().Swap(layoutsEvents[i]);
+  }
+  layoutsEvents.clear();
+
+  for (gd::Behavior* behavior : defaultBehaviors) {
+    behavior->SetDefaultBehavior(true);
+  }
+  defaultBehaviors.clear();
+
+  project.GetTests() = tests;
+  project.externalEvents.swap(externalEvents);
+  project.GetObjects().GetObjectGroups() = objectGroups;
+}
+
+}  // namespace gd
@@ -0,0 +1,155 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Project/LoadingScreen.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/PlatformSpecificAssets.h"
+#include "GDCore/Project/TestsContainer.h"
+#include "GDCore/Project/Watermark.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class Behavior;
+class EventsBasedBehavior;
+class EventsBasedObject;
+class EventsFunction;
+class EventsFunctionsExtension;
+class ExternalEvents;
+class NamedPropertyDescriptor;
+class Resource;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Apply the changes done to a project by an export directly on this
+ * project, and roll them back when the overlay is destroyed.
+ *
+ * This avoids cloning the whole project before exporting it (a clone is a
+ * deep copy of every layout, event and object, and loses the parsed
+ * expressions of the events).
+ *
+ * Only the parts of the project which are declared as modified are saved:
+ * - the resources (files, metadata and added resources) and the loading
+ * screen, watermark, platform specific assets and authors,
+ * - the parts removed by the stripping of the project (events, object
+ * groups, external events, tests and the events functions extensions data
+ * useless for the runtime). They are moved aside, not copied.
+ *
+ * \warning Events are not protected: when
+ * gd::ProjectExportOverlay::CanBeUsedOn returns false, the export must be
+ * done on a copy of the project instead.
+ *
+ * \see gd::ProjectStripper
+ */
+class GD_CORE_API ProjectExportOverlay {
+ public:
+  ProjectExportOverlay(gd::Project& project_);
+  ProjectExportOverlay(const ProjectExportOverlay&) = delete;
+  ProjectExportOverlay& operator=(const ProjectExportOverlay&) = delete;
+
+  /**
+   * \brief Restore the project as it was before the overlay was created.
+   */
+  virtual ~ProjectExportOverlay();
+
+  /**
+   * \brief Check if an export can be done on the project itself, using an
+   * overlay.
+   *
+   * This is not the case if the events or objects still refer to files
+   * without using resources (old projects): the export would update their
+   * filenames in the events.
+   */
+  static bool CanBeUsedOn(gd::Project& project);
+
+  /**
+   * \brief Save the resources and the project properties that are updated
+   * during an export, so that they are restored afterwards.
+   *
+   * Resources added during the export are removed.
+   */
+  void PreserveResourcesAndProperties();
+
+  /**
+   * \brief Strip the project like gd::ProjectStripper::StripProjectForExport,
+   * but in a way that is undone when the overlay is destroyed.
+   */
+  void StripProjectForExport();
+
+ private:
+  struct PreservedResource {
+    gd::Resource* resource;
+    gd::String file;
+    gd::String metadata;
+  };
+
+  struct StrippedEventsBasedObject {
+    StrippedEventsBasedObject() = default;
+    StrippedEventsBasedObject(StrippedEventsBasedObject&&) = default;
+
+    gd::EventsBasedObject* eventsBasedObject = nullptr;
+    gd::String fullName;
+    gd::String description;
+    std::vector<std::unique_ptr<gd::EventsFunction>> eventsFunctions;
+    std::vector<std::unique_ptr<gd::NamedPropertyDescriptor>>
+        propertyDescriptors;
+  };
+
+  struct StrippedExtension {
+    StrippedExtension() = default;
+    StrippedExtension(StrippedExtension&&) = default;
+
+    gd::EventsFunctionsExtension* extension = nullptr;
+    gd::String fullName;
+    gd::String shortDescription;
+    gd::String description;
+    gd::String helpPath;
+    gd::String iconUrl;
+    gd::String previewIconUrl;
+    gd::String originName;
+    gd::String originIdentifier;
+    gd::String version;
+    std::vector<std::unique_ptr<gd::EventsBasedBehavior>> eventsBasedBehaviors;
+    std::vector<std::unique_ptr<gd::EventsFunction>> eventsFunctions;
+    gd::TestsContainer tests;
+    std::vector<StrippedEventsBasedObject> eventsBasedObjects;
+  };
+
+  void RestoreResourcesAndProperties();
+  void RestoreStrippedProject();
+
+  gd::Project& project;
+
+  bool resourcesAndPropertiesPreserved = false;
+  std::vector<PreservedResource> preservedResources;
+  gd::PlatformSpecificAssets platformSpecificAssets;
+  gd::LoadingScreen loadingScreen;
+  gd::Watermark watermark;
+  std::vector<gd::String> authorIds;
+  std::vector<gd::String> authorUsernames;
+
+  bool stripped = false;
+  gd::ObjectGroupsContainer objectGroups;
+  std::vector<std::unique_ptr<gd::ExternalEvents>> externalEvents;
+  gd::TestsContainer tests;
+  std::vector<gd::Behavior*> defaultBehaviors;
+  std::vector<gd::EventsList> layoutsEvents;
+  /// The removed extensions, with their original position.
+  std::vector<
+      std::pair<std::size_t, std::unique_ptr<gd::EventsFunctionsExtension>>>
+      removedExtensions;
+  std::vector<StrippedExtension> strippedExtensions;
+};
+
+}  // namespace gd
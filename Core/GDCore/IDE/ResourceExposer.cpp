@@ -29,6 +29,11 @@ void ResourceExposer::ExposeWholeProjectResources(
   // Expose any project resources as files.
   worker.ExposeResources();
 
+  ExposeWholeProjectResourcesReferences(project, worker);
+}
+
+void ResourceExposer::ExposeWholeProjectResourcesReferences(
+    gd::Project &project, gd::ArbitraryResourceWorker &worker) {
   project.GetPlatformSpecificAssets().ExposeResources(worker);
 
   // Expose event resources
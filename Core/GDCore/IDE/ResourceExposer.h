@@ -37,6 +37,16 @@ public:
   static void ExposeWholeProjectResources(gd::Project &project,
                                           gd::ArbitraryResourceWorker &worker);
 
+  /**
+   * \brief Expose the resources referenced in a project (by its objects,
+   * events, effects, loading screen...) without exposing the resources of the
+   * project resources manager.
+   *
+   * \see ExposeWholeProjectResources
+   */
+  static void ExposeWholeProjectResourcesReferences(
+      gd::Project &project, gd::ArbitraryResourceWorker &worker);
+
   /**
    * @brief Expose only the resources used globally on a project.
    *
@@ -14,6 +14,7 @@ SceneNameMangler *SceneNameMangler::_singleton = nullptr;
 
 const gd::String &SceneNameMangler::GetMangledSceneName(
     const gd::String &sceneName) {
+  std::lock_guard<std::mutex> lock(mangledSceneNamesMutex);
   auto it = mangledSceneNames.find(sceneName);
   if (it != mangledSceneNames.end()) {
     return it->second;
@@ -25,6 +25,7 @@
 #include "GDCore/IDE/Events/EventsPropertyReplacer.h"
 #include "GDCore/IDE/Events/EventsRefactorer.h"
 #include "GDCore/IDE/Events/EventsVariableInstructionTypeSwitcher.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/IDE/Events/EventsVariableReplacer.h"
 #include "GDCore/IDE/Events/ExpressionsParameterMover.h"
 #include "GDCore/IDE/Events/ExpressionsRenamer.h"
@@ -751,7 +752,8 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
 void WholeProjectRefactorer::RenameEventsFunction(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
-    const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+    const gd::String &oldFunctionName, const gd::String &newFunctionName,
+    gd::EventsReferencesIndex *referencesIndex) {
   const auto &eventsFunctions = eventsFunctionsExtension.GetEventsFunctions();
   if (!eventsFunctions.HasEventsFunctionNamed(oldFunctionName))
     return;
@@ -766,7 +768,7 @@ void WholeProjectRefactorer::RenameEventsFunction(
           eventsFunctionsExtension.GetName(), oldFunctionName),
       gd::PlatformExtension::GetEventsFunctionFullType(
           eventsFunctionsExtension.GetName(), newFunctionName),
-      wholeProjectExposer);
+      wholeProjectExposer, referencesIndex);
 
   if (eventsFunction.GetFunctionType() ==
       gd::EventsFunction::ExpressionAndCondition) {
@@ -784,7 +786,8 @@ void WholeProjectRefactorer::RenameBehaviorEventsFunction(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::EventsBasedBehavior &eventsBasedBehavior,
-    const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+    const gd::String &oldFunctionName, const gd::String &newFunctionName,
+    gd::EventsReferencesIndex *referencesIndex) {
   auto &eventsFunctions = eventsBasedBehavior.GetEventsFunctions();
   if (!eventsFunctions.HasEventsFunctionNamed(oldFunctionName))
     return;
@@ -802,6 +805,8 @@ void WholeProjectRefactorer::RenameBehaviorEventsFunction(
         gd::PlatformExtension::GetBehaviorFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
         oldFunctionName, newFunctionName);
+    if (referencesIndex)
+      renamer.SetEventsReferencesFilter(*referencesIndex, oldFunctionName);
     gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
   }
   if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
@@ -813,6 +818,8 @@ void WholeProjectRefactorer::RenameBehaviorEventsFunction(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             newFunctionName));
+    if (referencesIndex)
+      renamer.SetEventsReferencesFilter(*referencesIndex, oldFunctionName);
     gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
   }
   if (eventsFunction.GetFunctionType() ==
@@ -832,7 +839,8 @@ void WholeProjectRefactorer::RenameObjectEventsFunction(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::EventsBasedObject &eventsBasedObject,
-    const gd::String &oldFunctionName, const gd::String &newFunctionName) {
+    const gd::String &oldFunctionName, const gd::String &newFunctionName,
+    gd::EventsReferencesIndex *referencesIndex) {
   auto &eventsFunctions = eventsBasedObject.GetEventsFunctions();
   if (!eventsFunctions.HasEventsFunctionNamed(oldFunctionName))
     return;
@@ -847,6 +855,8 @@ void WholeProjectRefactorer::RenameObjectEventsFunction(
         gd::PlatformExtension::GetObjectFullType(
             eventsFunctionsExtension.GetName(), eventsBasedObject.GetName()),
         oldFunctionName, newFunctionName);
+    if (referencesIndex)
+      renamer.SetEventsReferencesFilter(*referencesIndex, oldFunctionName);
     gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
   }
   if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
@@ -858,6 +868,8 @@ void WholeProjectRefactorer::RenameObjectEventsFunction(
         gd::PlatformExtension::GetObjectEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
             newFunctionName));
+    if (referencesIndex)
+      renamer.SetEventsReferencesFilter(*referencesIndex, oldFunctionName);
     gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
   }
   if (eventsFunction.GetFunctionType() ==
@@ -1779,7 +1791,8 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
 void WholeProjectRefactorer::DoRenameEventsFunction(
     gd::Project &project, const gd::EventsFunction &eventsFunction,
     const gd::String &oldFullType, const gd::String &newFullType,
-    const gd::ProjectBrowser &projectBrowser) {
+    const gd::ProjectBrowser &projectBrowser,
+    gd::EventsReferencesIndex *referencesIndex) {
   // Order is important: we first rename the expressions then the instructions,
   // to avoid being unable to fetch the metadata (the types of parameters) of
   // instructions after they are renamed.
@@ -1787,11 +1800,15 @@ void WholeProjectRefactorer::DoRenameEventsFunction(
     gd::ExpressionsRenamer renamer =
         gd::ExpressionsRenamer(project.GetCurrentPlatform());
     renamer.SetReplacedFreeExpression(oldFullType, newFullType);
+    if (referencesIndex)
+      renamer.SetEventsReferencesFilter(*referencesIndex, oldFullType);
     projectBrowser.ExposeEvents(project, renamer);
   }
   if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
     gd::InstructionsTypeRenamer renamer =
         gd::InstructionsTypeRenamer(project, oldFullType, newFullType);
+    if (referencesIndex)
+      renamer.SetEventsReferencesFilter(*referencesIndex, oldFullType);
     projectBrowser.ExposeEvents(project, renamer);
   }
 }
@@ -1884,15 +1901,18 @@ void WholeProjectRefactorer::BehaviorsAddedToObjectInScene(
 
 void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
     gd::Project &project, gd::Layout &layout, const gd::String &oldName,
-    const gd::String &newName, bool isObjectGroup) {
+    const gd::String &newName, bool isObjectGroup,
+    gd::EventsReferencesIndex *referencesIndex) {
   gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
-      project, layout, layout.GetObjects(), oldName, newName, isObjectGroup);
+      project, layout, layout.GetObjects(), oldName, newName, isObjectGroup,
+      referencesIndex);
 }
 
 void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
     gd::Project &project, gd::Layout &layout,
     const gd::ObjectsContainer &targetedObjectsContainer,
-    const gd::String &oldName, const gd::String &newName, bool isObjectGroup) {
+    const gd::String &oldName, const gd::String &newName, bool isObjectGroup,
+    gd::EventsReferencesIndex *referencesIndex) {
 
   if (oldName == newName || newName.empty() || oldName.empty())
     return;
@@ -1903,7 +1923,7 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
   // Rename object in the current layout
   gd::EventsRefactorer::RenameObjectInEvents(
       project.GetCurrentPlatform(), projectScopedContainers, layout.GetEvents(),
-      layout.GetObjects(), oldName, newName);
+      layout.GetObjects(), oldName, newName, referencesIndex);
 
   // Object groups can't have instances or be in other groups
   if (!isObjectGroup) {
@@ -1920,7 +1940,8 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
     auto &externalEvents = project.GetExternalEvents(externalEventsName);
     gd::EventsRefactorer::RenameObjectInEvents(
         project.GetCurrentPlatform(), projectScopedContainers,
-        externalEvents.GetEvents(), layout.GetObjects(), oldName, newName);
+        externalEvents.GetEvents(), layout.GetObjects(), oldName, newName,
+        referencesIndex);
   }
 
   // Rename object in external layouts
@@ -2221,7 +2242,7 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInEventsFunction(
 
 void WholeProjectRefactorer::GlobalObjectOrGroupRenamed(
     gd::Project &project, const gd::String &oldName, const gd::String &newName,
-    bool isObjectGroup) {
+    bool isObjectGroup, gd::EventsReferencesIndex *referencesIndex) {
   // Object groups can't be in other groups
   if (!isObjectGroup) {
     for (std::size_t g = 0; g < project.GetObjects().GetObjectGroups().size();
@@ -2236,7 +2257,7 @@ void WholeProjectRefactorer::GlobalObjectOrGroupRenamed(
       continue;
 
     ObjectOrGroupRenamedInScene(project, layout, project.GetObjects(), oldName, newName,
-                                 isObjectGroup);
+                                 isObjectGroup, referencesIndex);
   }
 }
 
@@ -33,6 +33,7 @@ class ProjectBrowser;
 class SerializerElement;
 class ProjectScopedContainers;
 class InitialInstancesContainer;
+class EventsReferencesIndex;
 struct VariablesRenamingChangesetNode;
 }  // namespace gd
 
@@ -160,12 +161,16 @@ class GD_CORE_API WholeProjectRefactorer {
    * \warning Do the renaming of the specified function after calling this.
    * This is because the function is expected to have its old name for the
    * refactoring.
+   *
+   * If an index is given, only the events that can reference the function
+   * are browsed.
    */
   static void RenameEventsFunction(
       gd::Project& project,
       const gd::EventsFunctionsExtension& eventsFunctionsExtension,
       const gd::String& oldFunctionName,
-      const gd::String& newFunctionName);
+      const gd::String& newFunctionName,
+      gd::EventsReferencesIndex* referencesIndex = nullptr);
 
   /**
    * \brief Refactor the project **before** an events function of a behavior is
@@ -174,13 +179,17 @@ class GD_CORE_API WholeProjectRefactorer {
    * \warning Do the renaming of the specified function after calling this.
    * This is because the function is expected to have its old name for the
    * refactoring.
+   *
+   * If an index is given, only the events that can reference the function
+   * are browsed.
    */
   static void RenameBehaviorEventsFunction(
       gd::Project& project,
       const gd::EventsFunctionsExtension& eventsFunctionsExtension,
       const gd::EventsBasedBehavior& eventsBasedBehavior,
       const gd::String& oldFunctionName,
-      const gd::String& newFunctionName);
+      const gd::String& newFunctionName,
+      gd::EventsReferencesIndex* referencesIndex = nullptr);
 
   /**
    * \brief Refactor the project **before** an events function of an object is
@@ -189,13 +198,17 @@ class GD_CORE_API WholeProjectRefactorer {
    * \warning Do the renaming of the specified function after calling this.
    * This is because the function is expected to have its old name for the
    * refactoring.
+   *
+   * If an index is given, only the events that can reference the function
+   * are browsed.
    */
   static void RenameObjectEventsFunction(
       gd::Project& project,
       const gd::EventsFunctionsExtension& eventsFunctionsExtension,
       const gd::EventsBasedObject& eventsBasedObject,
       const gd::String& oldFunctionName,
-      const gd::String& newFunctionName);
+      const gd::String& newFunctionName,
+      gd::EventsReferencesIndex* referencesIndex = nullptr);
 
   /**
    * \brief Refactor the function **before** a parameter is renamed.
@@ -534,12 +547,14 @@ class GD_CORE_API WholeProjectRefactorer {
    *
    * This will update the layout, all external layouts associated with it
    * and all external events associated with it.
+   *
+   * If an index is given, only the events that can reference the object are
+   * browsed. This is useful to do a lot of renamings in a big project.
    */
-  static void ObjectOrGroupRenamedInScene(gd::Project &project,
-                                          gd::Layout &scene,
-                                          const gd::String &oldName,
-                                          const gd::String &newName,
-                                          bool isObjectGroup);
+  static void ObjectOrGroupRenamedInScene(
+      gd::Project &project, gd::Layout &scene, const gd::String &oldName,
+      const gd::String &newName, bool isObjectGroup,
+      gd::EventsReferencesIndex *referencesIndex = nullptr);
 
   /**
    * \brief Refactor the project after an object is removed in a layout
@@ -615,11 +630,14 @@ class GD_CORE_API WholeProjectRefactorer {
    *
    * This will update all the layouts, all external layouts associated with them
    * and all external events used by the layouts.
+   *
+   * If an index is given, only the events that can reference the object are
+   * browsed.
    */
-  static void GlobalObjectOrGroupRenamed(gd::Project& project,
-                                         const gd::String& oldName,
-                                         const gd::String& newName,
-                                         bool isObjectGroup);
+  static void GlobalObjectOrGroupRenamed(
+      gd::Project &project, const gd::String &oldName,
+      const gd::String &newName, bool isObjectGroup,
+      gd::EventsReferencesIndex *referencesIndex = nullptr);
 
   /**
    * \brief Refactor the project after a global object is removed.
@@ -731,7 +749,8 @@ class GD_CORE_API WholeProjectRefactorer {
                                           const gd::ObjectsContainer &targetedObjectsContainer,
                                           const gd::String &oldName,
                                           const gd::String &newName,
-                                          bool isObjectGroup);
+                                          bool isObjectGroup,
+                                          gd::EventsReferencesIndex *referencesIndex);
   static std::vector<gd::String> GetAssociatedExternalLayouts(
       gd::Project& project, gd::Layout& layout);
   static std::vector<gd::String>
@@ -741,11 +760,13 @@ class GD_CORE_API WholeProjectRefactorer {
   GetAssociatedExternalEvents(gd::Project &project,
                                const gd::String &layoutName);
 
-  static void DoRenameEventsFunction(gd::Project& project,
-                                     const gd::EventsFunction& eventsFunction,
-                                     const gd::String& oldFullType,
-                                     const gd::String& newFullType,
-                                     const gd::ProjectBrowser& projectBrowser);
+  static void DoRenameEventsFunction(
+      gd::Project& project,
+      const gd::EventsFunction& eventsFunction,
+      const gd::String& oldFullType,
+      const gd::String& newFullType,
+      const gd::ProjectBrowser& projectBrowser,
+      gd::EventsReferencesIndex* referencesIndex = nullptr);
 
   static void DoRenameBehavior(gd::Project& project,
                                const gd::String& oldBehaviorType,
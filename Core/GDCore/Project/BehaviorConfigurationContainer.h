@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Project/QuickCustomization.h"
 #include "GDCore/Project/QuickCustomizationVisibilitiesContainer.h"
 #include "GDCore/Serialization/Serializer.h"
@@ -65,7 +66,10 @@ class GD_CORE_API BehaviorConfigurationContainer {
   /**
    * \brief Set the type of the behavior.
    */
-  void SetTypeName(const gd::String& type_) { type = type_; };
+  void SetTypeName(const gd::String& type_) {
+    type = type_;
+    gd::ObjectsStructureRevision::Increment();
+  };
 
   /**
    * \brief Called when the IDE wants to know about the custom properties of the
@@ -10,6 +10,7 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/CustomBehavior.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/QuickCustomization.h"
@@ -27,6 +28,7 @@ BehaviorsContainer::BehaviorsContainer(bool isOverriding_)
 void BehaviorsContainer::Init(const gd::BehaviorsContainer &behaviorsContainer) {
   isOverriding = behaviorsContainer.isOverriding;
   behaviors = gd::Clone(behaviorsContainer.behaviors);
+  gd::ObjectsStructureRevision::Increment();
 }
 
 std::vector<gd::String> BehaviorsContainer::GetAllBehaviorNames() const {
@@ -40,6 +42,7 @@ std::vector<gd::String> BehaviorsContainer::GetAllBehaviorNames() const {
 
 void BehaviorsContainer::RemoveBehavior(const gd::String &name) {
   behaviors.erase(name);
+  gd::ObjectsStructureRevision::Increment();
 }
 
 bool BehaviorsContainer::RenameBehavior(const gd::String &name,
@@ -52,6 +55,7 @@ bool BehaviorsContainer::RenameBehavior(const gd::String &name,
   behaviors.erase(name);
   behaviors[newName] = std::move(aut);
   behaviors[newName]->SetName(newName);
+  gd::ObjectsStructureRevision::Increment();
 
   return true;
 }
@@ -83,6 +87,7 @@ gd::Behavior *BehaviorsContainer::AddNewBehavior(const gd::Project &project,
       behavior->InitializeContent();
     }
     this->behaviors[name] = std::move(behavior);
+    gd::ObjectsStructureRevision::Increment();
     return this->behaviors[name].get();
   };
 
@@ -110,6 +115,7 @@ gd::Behavior *BehaviorsContainer::AddNewBehavior(const gd::Project &project,
 gd::Behavior *BehaviorsContainer::AddBehavior(const gd::Behavior &behavior,
                                               const gd::String &name) {
   behaviors[name] = std::move(behavior.Clone());
+  gd::ObjectsStructureRevision::Increment();
   return behaviors[name].get();
 }
 
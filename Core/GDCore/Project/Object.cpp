@@ -11,6 +11,7 @@
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/CustomBehavior.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/QuickCustomization.h"
@@ -20,6 +21,8 @@
 
 namespace gd {
 
+std::atomic<std::size_t> Object::namesRevision(0);
+
 Object::~Object() {}
 
 Object::Object(const gd::String& name_,
@@ -43,11 +46,15 @@ Object::Object(const gd::String& name_,
 void Object::Init(const gd::Object& object) {
   CopyWithoutConfiguration(object);
   configuration = object.configuration->Clone();
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void Object::CopyWithoutConfiguration(const gd::Object& object) {
   persistentUuid = object.persistentUuid;
-  name = object.name;
+  if (name != object.name) {
+    name = object.name;
+    namesRevision++;
+  }
   assetStoreId = object.assetStoreId;
   objectVariables = object.objectVariables;
   effectsContainer = object.effectsContainer;
@@ -95,7 +102,11 @@ void Object::UnserializeFrom(gd::Project& project,
 
   SetType(element.GetStringAttribute("type"));
   assetStoreId = element.GetStringAttribute("assetStoreId");
-  name = element.GetStringAttribute("name", name, "nom");
+  gd::String newName = element.GetStringAttribute("name", name, "nom");
+  if (name != newName) {
+    name = newName;
+    namesRevision++;
+  }
   resourcesPreloading = element.GetStringAttribute("resourcesPreloading", "with-scene");
 
   objectVariables.UnserializeFrom(
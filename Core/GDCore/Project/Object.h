@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <vector>
@@ -57,7 +58,7 @@ class GD_CORE_API Object {
   /**
    * Copy constructor. Calls Init().
    */
-  Object(const gd::Object& object) { Init(object); };
+  Object(const gd::Object& object) : name(object.name) { Init(object); };
 
   /**
    * Assignment operator. Calls Init().
@@ -100,12 +101,21 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_) {
+    name = name_;
+    namesRevision++;
+  };
 
   /** \brief Return the name of the object.
    */
   const gd::String& GetName() const { return name; };
 
+  /** \brief Return a number that changes every time an object is renamed.
+   *
+   * \see gd::NameIndex
+   */
+  static std::size_t GetNamesRevision() { return namesRevision; };
+
   /** \brief Change the asset store id of the object.
    */
   void SetAssetStoreId(const gd::String& assetStoreId_) {
@@ -306,6 +316,8 @@ class GD_CORE_API Object {
    * behaviors and it must be a deep copy.
    */
   void Init(const gd::Object& object);
+
+  static std::atomic<std::size_t> namesRevision;
 };
 
 /**
@@ -12,6 +12,7 @@
 
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/EffectsContainer.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Project/ResourcesContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
@@ -63,6 +64,7 @@ class GD_CORE_API ObjectConfiguration {
    */
   void SetType(const gd::String& type_) {
     type = type_;
+    gd::ObjectsStructureRevision::Increment();
   }
 
   /** \brief Return the type of the object.
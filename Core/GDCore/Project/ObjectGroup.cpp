@@ -23,12 +23,14 @@ bool ObjectGroup::Find(const gd::String& name) const {
 
 void ObjectGroup::AddObject(const gd::String& name) {
   if (!Find(name)) memberObjects.push_back(name);
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectGroup::RemoveObject(const gd::String& name) {
   memberObjects.erase(
       std::remove(memberObjects.begin(), memberObjects.end(), name),
       memberObjects.end());
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectGroup::RenameObject(const gd::String& oldName,
@@ -36,6 +38,7 @@ void ObjectGroup::RenameObject(const gd::String& oldName,
   for (auto& object : memberObjects) {
     if (object == oldName) object = newName;
   }
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectGroup::SerializeTo(SerializerElement& element) const {
@@ -51,6 +54,7 @@ void ObjectGroup::SerializeTo(SerializerElement& element) const {
 void ObjectGroup::UnserializeFrom(const SerializerElement& element) {
   SetName(element.GetStringAttribute("name", "", "nom"));
   memberObjects.clear();
+  gd::ObjectsStructureRevision::Increment();
 
   // Compatibility with GD <= 3.3
   if (element.HasChild("Objet")) {
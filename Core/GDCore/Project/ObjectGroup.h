@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/String.h"
 
 namespace gd {
@@ -56,7 +57,10 @@ class GD_CORE_API ObjectGroup {
 
   /** \brief Change group name
    */
-  inline void SetName(const gd::String& name_) { name = name_; };
+  inline void SetName(const gd::String& name_) {
+    name = name_;
+    gd::ObjectsStructureRevision::Increment();
+  };
 
   /**
    * \brief Get a vector with objects names.
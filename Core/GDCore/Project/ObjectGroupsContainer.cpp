@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
@@ -35,6 +36,7 @@ void ObjectGroupsContainer::Init(const ObjectGroupsContainer& other) {
   for (auto& it : other.objectGroups) {
     objectGroups.push_back(gd::make_unique<gd::ObjectGroup>(*it));
   }
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectGroupsContainer::SerializeTo(SerializerElement& element) const {
@@ -106,6 +108,7 @@ void ObjectGroupsContainer::Remove(const gd::String& name) {
                        return group->GetName() == name;
                      }),
       objectGroups.end());
+  gd::ObjectsStructureRevision::Increment();
 }
 
 std::size_t ObjectGroupsContainer::GetPosition(const gd::String& name) const {
@@ -132,6 +135,7 @@ ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
       position < objectGroups.size() ? objectGroups.begin() + position
                                      : objectGroups.end(),
       gd::make_unique<gd::ObjectGroup>(group))));
+  gd::ObjectsStructureRevision::Increment();
   return newlyInsertedGroup;
 }
 
@@ -160,6 +164,7 @@ void ObjectGroupsContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
       std::move(objectGroups[oldIndex]);
   objectGroups.erase(objectGroups.begin() + oldIndex);
   objectGroups.insert(objectGroups.begin() + newIndex, std::move(objectGroup));
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectGroupsContainer::ForEachNameMatchingSearch(
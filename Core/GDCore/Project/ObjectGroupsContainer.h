@@ -12,6 +12,7 @@
 
 #include "GDCore/Project/MemoryTrackedRegistry.h"
 #include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/String.h"
 namespace gd {
 class SerializerElement;
@@ -116,7 +117,10 @@ class GD_CORE_API ObjectGroupsContainer {
   /**
    * \brief Clear all groups of the container.
    */
-  inline void Clear() { objectGroups.clear(); }
+  inline void Clear() {
+    objectGroups.clear();
+    gd::ObjectsStructureRevision::Increment();
+  }
 
   /**
    * \brief Call the callback for each group name matching the specified search.
@@ -10,6 +10,7 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectFolderOrObject.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/PolymorphicClone.h"
@@ -38,6 +39,8 @@ void ObjectsContainer::Init(const gd::ObjectsContainer& other) {
   sourceType = other.sourceType;
   initialObjects = gd::Clone(other.initialObjects);
   objectGroups = other.objectGroups;
+  objectsIndex.Invalidate();
+  gd::ObjectsStructureRevision::Increment();
   // The objects folders are not copied.
   // It's not an issue because the UI uses the serialization for duplication.
   rootFolder = gd::make_unique<gd::ObjectFolderOrObject>("__ROOT");
@@ -84,28 +87,21 @@ void ObjectsContainer::UnserializeObjectsFrom(
       std::cout << "WARNING: Unknown object type \"" << type << "\""
                 << std::endl;
   }
+  objectsIndex.Invalidate();
+  gd::ObjectsStructureRevision::Increment();
 }
 
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  [&](const std::unique_ptr<gd::Object>& object) {
-                    return object->GetName() == name;
-                  }) != initialObjects.end());
+  return objectsIndex.Find(
+             name, initialObjects, gd::Object::GetNamesRevision()) != nullptr;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *objectsIndex.Find(
+      name, initialObjects, gd::Object::GetNamesRevision());
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *objectsIndex.Find(
+      name, initialObjects, gd::Object::GetNamesRevision());
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -114,8 +110,12 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
+  const gd::Object* object =
+      objectsIndex.Find(name, initialObjects, gd::Object::GetNamesRevision());
+  if (!object) return gd::String::npos;
+
   for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
+    if (initialObjects[i].get() == object) return i;
   }
   return gd::String::npos;
 }
@@ -130,6 +130,9 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
       project.CreateObject(objectType, name))));
+  objectsIndex.OnItemInserted(
+      newlyCreatedObject, initialObjects, gd::Object::GetNamesRevision());
+  gd::ObjectsStructureRevision::Increment();
 
   rootFolder->InsertObject(&newlyCreatedObject);
 
@@ -144,6 +147,9 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
     std::size_t position) {
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       initialObjects.end(), project.CreateObject(objectType, name))));
+  objectsIndex.OnItemInserted(
+      newlyCreatedObject, initialObjects, gd::Object::GetNamesRevision());
+  gd::ObjectsStructureRevision::Increment();
 
   objectFolderOrObject.InsertObject(&newlyCreatedObject, position);
 
@@ -156,6 +162,9 @@ gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
       std::unique_ptr<gd::Object>(object.Clone()))));
+  objectsIndex.OnItemInserted(
+      newlyCreatedObject, initialObjects, gd::Object::GetNamesRevision());
+  gd::ObjectsStructureRevision::Increment();
 
   return newlyCreatedObject;
 }
@@ -167,25 +176,37 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
+  objectsIndex.OnItemsMoved();
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
+  const gd::Object* object =
+      objectsIndex.Find(name, initialObjects, gd::Object::GetNamesRevision());
+  if (!object) return;
+
   std::vector<std::unique_ptr<gd::Object>>::iterator objectIt =
       find_if(initialObjects.begin(),
               initialObjects.end(),
-              [&](const std::unique_ptr<gd::Object>& object) {
-                return object->GetName() == name;
+              [&](const std::unique_ptr<gd::Object>& initialObject) {
+                return initialObject.get() == object;
               });
-  if (objectIt == initialObjects.end()) return;
 
   rootFolder->RemoveRecursivelyObjectNamed(name);
 
+  // Copy the name as it can be the one of the removed object.
+  gd::String removedObjectName = name;
   initialObjects.erase(objectIt);
+  objectsIndex.OnItemRemoved(
+      removedObjectName, initialObjects, gd::Object::GetNamesRevision());
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectsContainer::Clear() {
   rootFolder->Clear();
   initialObjects.clear();
+  objectsIndex.Invalidate();
+  gd::ObjectsStructureRevision::Increment();
 }
 
 void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
@@ -205,8 +226,14 @@ void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
 
   std::unique_ptr<gd::Object> object = std::move(*objectIt);
   initialObjects.erase(objectIt);
+  objectsIndex.OnItemRemoved(
+      object->GetName(), initialObjects, gd::Object::GetNamesRevision());
 
   newContainer.initialObjects.push_back(std::move(object));
+  newContainer.objectsIndex.OnItemInserted(*newContainer.initialObjects.back(),
+                                           newContainer.initialObjects,
+                                           gd::Object::GetNamesRevision());
+  gd::ObjectsStructureRevision::Increment();
 
   objectFolderOrObject.GetParent().MoveObjectFolderOrObjectToAnotherFolder(
       objectFolderOrObject, newParentFolder, newPosition);
@@ -12,6 +12,7 @@
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/ObjectFolderOrObject.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class Object;
 class Project;
@@ -174,6 +175,9 @@ class GD_CORE_API ObjectsContainer {
 
   /**
    * Provide a raw access to the vector containing the objects
+   *
+   * \note Objects can be reordered but must not be replaced by others
+   * through this vector, as they would not be found by their names.
    */
   std::vector<std::unique_ptr<gd::Object> >& GetObjects() {
     return initialObjects;
@@ -253,6 +257,7 @@ class GD_CORE_API ObjectsContainer {
  private:
   SourceType sourceType = Unknown;
   std::unique_ptr<gd::ObjectFolderOrObject> rootFolder;
+  gd::NameIndex<gd::Object> objectsIndex;  ///< Find objects by name.
   gd::MemoryTracked _memoryTracked{this, "ObjectsContainer"};
 
   /**
@@ -5,6 +5,7 @@
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/ObjectsStructureRevision.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
@@ -82,9 +83,92 @@ const gd::Object* ObjectsContainersList::GetObject(const gd::String& name) const
   return nullptr;
 }
 
+const gd::ObjectsContainer& ObjectsContainersList::GetGlobalObjectsContainer()
+    const {
+  if (objectsContainers.size() == 1) {
+    static const gd::ObjectsContainer emptyObjectsContainer(
+        gd::ObjectsContainer::SourceType::Unknown);
+    return emptyObjectsContainer;
+  }
+
+  return *objectsContainers[0];
+}
+
+ObjectsContainersList::ResolvedGroup* ObjectsContainersList::GetResolvedGroup(
+    const gd::String& name) const {
+  if (resolvedGroupsStructureRevision != gd::ObjectsStructureRevision::Get() ||
+      resolvedGroupsNamesRevision != gd::Object::GetNamesRevision()) {
+    resolvedGroups.clear();
+    resolvedGroupsStructureRevision = gd::ObjectsStructureRevision::Get();
+    resolvedGroupsNamesRevision = gd::Object::GetNamesRevision();
+  }
+
+  auto resolvedGroupIt = resolvedGroups.find(name);
+  if (resolvedGroupIt != resolvedGroups.end()) return &resolvedGroupIt->second;
+
+  // An object having the same name as a group takes precedence over it in
+  // some methods: only cache groups which can't be confused with an object.
+  if (HasObjectNamed(name)) return nullptr;
+
+  const gd::ObjectGroup* group = nullptr;
+  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
+       ++it) {
+    if ((*it)->GetObjectGroups().Has(name)) {
+      group = &(*it)->GetObjectGroups().Get(name);
+      break;
+    }
+  }
+  if (!group) return nullptr;
+
+  ResolvedGroup& resolvedGroup = resolvedGroups[name];
+  resolvedGroup.objectNames = group->GetAllObjectsNames();
+  resolvedGroup.objects.reserve(resolvedGroup.objectNames.size());
+  for (const gd::String& objectName : resolvedGroup.objectNames) {
+    resolvedGroup.objects.push_back(GetObject(objectName));
+  }
+
+  // For groups, we consider that the first object of the group defines the
+  // variables available for this group.
+  if (!resolvedGroup.objects.empty() && resolvedGroup.objects[0]) {
+    resolvedGroup.variablesContainer =
+        &resolvedGroup.objects[0]->GetVariables();
+  }
+
+  if (objectsContainers.size() == 1 || objectsContainers.size() == 2) {
+    resolvedGroup.type = gd::GetTypeOfObject(
+        GetGlobalObjectsContainer(), GetSceneObjectsContainer(), name, true);
+    resolvedGroup.behaviors = gd::GetBehaviorsOfObject(
+        GetGlobalObjectsContainer(), GetSceneObjectsContainer(), name, true);
+  }
+
+  return &resolvedGroup;
+}
+
 ObjectsContainersList::VariableExistence
 ObjectsContainersList::HasObjectOrGroupWithVariableNamed(
     const gd::String& objectOrGroupName, const gd::String& variableName) const {
+  const ResolvedGroup* resolvedGroup = GetResolvedGroup(objectOrGroupName);
+  if (resolvedGroup) {
+    // Consider that a group has a variable if all objects of the group have
+    // it (see below).
+    if (resolvedGroup->objects.empty()) return VariableExistence::GroupIsEmpty;
+
+    bool existsOnAtLeastOneObject = false;
+    bool missingOnAtLeastOneObject = false;
+    for (const gd::Object* object : resolvedGroup->objects) {
+      if (object && object->GetVariables().Has(variableName))
+        existsOnAtLeastOneObject = true;
+      else
+        missingOnAtLeastOneObject = true;
+
+      if (existsOnAtLeastOneObject && missingOnAtLeastOneObject)
+        return VariableExistence::ExistsOnlyOnSomeObjectsOfTheGroup;
+    }
+
+    return missingOnAtLeastOneObject ? VariableExistence::DoesNotExist
+                                     : VariableExistence::Exists;
+  }
+
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
     if ((*it)->HasObjectNamed(objectOrGroupName)) {
@@ -147,6 +231,10 @@ bool ObjectsContainersList::HasObjectWithVariableNamed(
 bool ObjectsContainersList::HasObjectOrGroupVariablesContainer(
     const gd::String& objectOrGroupName,
     const gd::VariablesContainer& variablesContainer) const {
+  const ResolvedGroup* resolvedGroup = GetResolvedGroup(objectOrGroupName);
+  if (resolvedGroup)
+    return resolvedGroup->variablesContainer == &variablesContainer;
+
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
     if ((*it)->HasObjectNamed(objectOrGroupName)) {
@@ -188,6 +276,9 @@ bool ObjectsContainersList::HasObjectVariablesContainer(
 const gd::VariablesContainer*
 ObjectsContainersList::GetObjectOrGroupVariablesContainer(
     const gd::String& objectOrGroupName) const {
+  const ResolvedGroup* resolvedGroup = GetResolvedGroup(objectOrGroupName);
+  if (resolvedGroup) return resolvedGroup->variablesContainer;
+
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
     if ((*it)->HasObjectNamed(objectOrGroupName)) {
@@ -226,6 +317,18 @@ ObjectsContainersList::GetObjectVariablesContainer(
 
 gd::Variable::Type ObjectsContainersList::GetTypeOfObjectOrGroupVariable(
     const gd::String& objectOrGroupName, const gd::String& variableName) const {
+  const ResolvedGroup* resolvedGroup = GetResolvedGroup(objectOrGroupName);
+  if (resolvedGroup) {
+    // Consider that the first object having the variable will define its
+    // type (see below).
+    for (const gd::Object* object : resolvedGroup->objects) {
+      if (object && object->GetVariables().Has(variableName))
+        return object->GetVariables().Get(variableName).GetType();
+    }
+
+    return Variable::Type::Number;
+  }
+
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
     if ((*it)->HasObjectNamed(objectOrGroupName)) {
@@ -350,6 +453,25 @@ std::vector<gd::String> ObjectsContainersList::ExpandObjectName(
     const gd::String& onlyObjectToSelectIfPresent) const {
   std::vector<gd::String> realObjects;
 
+  const ResolvedGroup* resolvedGroup = GetResolvedGroup(objectOrGroupName);
+  if (resolvedGroup) {
+    const auto& objectNames = resolvedGroup->objectNames;
+    if (!onlyObjectToSelectIfPresent.empty() &&
+        find(objectNames.begin(),
+             objectNames.end(),
+             onlyObjectToSelectIfPresent) != objectNames.end()) {
+      if (HasObjectNamed(onlyObjectToSelectIfPresent))
+        realObjects.push_back(onlyObjectToSelectIfPresent);
+      return realObjects;
+    }
+
+    // Only return the objects actually existing.
+    for (std::size_t i = 0; i < objectNames.size(); ++i) {
+      if (resolvedGroup->objects[i]) realObjects.push_back(objectNames[i]);
+    }
+    return realObjects;
+  }
+
   // Check progressively each object container to find the object or the group
   // with the specified name.
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
@@ -415,6 +537,9 @@ gd::String ObjectsContainersList::GetTypeOfObject(
                    "objectsContainer");
     return "";
   }
+  const ResolvedGroup* resolvedGroup = GetResolvedGroup(objectName);
+  if (resolvedGroup) return resolvedGroup->type;
+
   if (objectsContainers.size() == 1) {
     gd::ObjectsContainer emptyObjectsContainer(
         gd::ObjectsContainer::SourceType::Unknown);
@@ -439,6 +564,18 @@ bool ObjectsContainersList::HasBehaviorInObjectOrGroup(
                    "objectsContainer");
     return false;
   }
+  ResolvedGroup* resolvedGroup = GetResolvedGroup(objectOrGroupName);
+  if (resolvedGroup) {
+    auto it = resolvedGroup->hasBehaviors.find(behaviorName);
+    if (it != resolvedGroup->hasBehaviors.end()) return it->second;
+
+    bool hasBehavior = gd::HasBehaviorInObjectOrGroup(
+        GetGlobalObjectsContainer(), GetSceneObjectsContainer(),
+        objectOrGroupName, behaviorName, true);
+    resolvedGroup->hasBehaviors[behaviorName] = hasBehavior;
+    return hasBehavior;
+  }
+
   if (objectsContainers.size() == 1) {
     gd::ObjectsContainer emptyObjectsContainer(
         gd::ObjectsContainer::SourceType::Unknown);
@@ -469,6 +606,19 @@ gd::String ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroup(
                    "objectsContainer");
     return "";
   }
+  ResolvedGroup* resolvedGroup =
+      searchInGroups ? GetResolvedGroup(objectOrGroupName) : nullptr;
+  if (resolvedGroup) {
+    auto it = resolvedGroup->behaviorTypes.find(behaviorName);
+    if (it != resolvedGroup->behaviorTypes.end()) return it->second;
+
+    gd::String behaviorType = gd::GetTypeOfBehaviorInObjectOrGroup(
+        GetGlobalObjectsContainer(), GetSceneObjectsContainer(),
+        objectOrGroupName, behaviorName, true);
+    resolvedGroup->behaviorTypes[behaviorName] = behaviorType;
+    return behaviorType;
+  }
+
   if (objectsContainers.size() == 1) {
     gd::ObjectsContainer emptyObjectsContainer(
         gd::ObjectsContainer::SourceType::Unknown);
@@ -524,6 +674,10 @@ std::vector<gd::String> ObjectsContainersList::GetBehaviorsOfObject(
     std::vector<gd::String> behaviors;
     return behaviors;
   }
+  const ResolvedGroup* resolvedGroup =
+      searchInGroups ? GetResolvedGroup(objectName) : nullptr;
+  if (resolvedGroup) return resolvedGroup->behaviors;
+
   if (objectsContainers.size() == 1) {
     gd::ObjectsContainer emptyObjectsContainer(
         gd::ObjectsContainer::SourceType::Unknown);
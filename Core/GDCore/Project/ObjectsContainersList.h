@@ -1,4 +1,5 @@
 #pragma once
+#include <unordered_map>
 #include <vector>
 
 #include "Variable.h"
@@ -19,6 +20,14 @@ namespace gd {
  * \brief A list of objects containers, useful for accessing objects in a
  * scoped way, along with methods to access them.
  *
+ * The information resolved from the objects of a group (its type, its
+ * behaviors, its variables container...) is cached until objects, their
+ * behaviors or groups are modified (see gd::ObjectsStructureRevision), so
+ * that using groups is not slower than using objects.
+ *
+ * \note The cache is not protected against concurrent accesses: a list must
+ * be used by one thread at a time (like the containers it refers to).
+ *
  * \see gd::Object
  * \see gd::ObjectsContainer
  * \see gd::Project
@@ -263,9 +272,47 @@ class GD_CORE_API ObjectsContainersList {
 
   void Add(const gd::ObjectsContainer& objectsContainer) {
     objectsContainers.push_back(&objectsContainer);
+    resolvedGroups.clear();
+  };
+
+  /**
+   * \brief The information resolved from the objects of a group.
+   */
+  struct ResolvedGroup {
+    std::vector<gd::String> objectNames;  ///< The names of the group.
+    std::vector<const gd::Object*>
+        objects;  ///< The object of each name, or nullptr if it does not exist.
+    const gd::VariablesContainer* variablesContainer = nullptr;
+    gd::String type;
+    std::vector<gd::String> behaviors;
+    std::unordered_map<gd::String, gd::String>
+        behaviorTypes;  ///< Filled when the type of a behavior is requested.
+    std::unordered_map<gd::String, bool>
+        hasBehaviors;  ///< Filled when a behavior is searched.
+  };
+
+  /**
+   * \brief Return the resolved group named \a name, or nullptr if there is no
+   * such group or if an object has this name.
+   */
+  ResolvedGroup* GetResolvedGroup(const gd::String& name) const;
+
+  /**
+   * \brief Return the containers to use for the methods working with global
+   * and scene objects.
+   *
+   * \warning Only valid when there are 1 or 2 containers.
+   */
+  const gd::ObjectsContainer& GetGlobalObjectsContainer() const;
+  const gd::ObjectsContainer& GetSceneObjectsContainer() const {
+    return *objectsContainers.back();
   };
 
   std::vector<const gd::ObjectsContainer*> objectsContainers;
+
+  mutable std::unordered_map<gd::String, ResolvedGroup> resolvedGroups;
+  mutable std::size_t resolvedGroupsStructureRevision = 0;
+  mutable std::size_t resolvedGroupsNamesRevision = 0;
 };
 
 }  // namespace gd
\ No newline at end of file
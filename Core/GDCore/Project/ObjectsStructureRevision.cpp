@@ -0,0 +1,12 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/ObjectsStructureRevision.h"
+
+namespace gd {
+
+std::atomic<std::size_t> ObjectsStructureRevision::revision(0);
+
+}  // namespace gd
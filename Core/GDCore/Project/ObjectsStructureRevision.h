@@ -0,0 +1,42 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief A number changing every time objects are inserted, removed or
+ * moved in a container, when their type or behaviors are changed, or when
+ * objects groups are modified.
+ *
+ * It's used to know if information resolved from objects and groups (like
+ * the type or the behaviors of a group) can still be used.
+ *
+ * \note Objects renaming is tracked by gd::Object::GetNamesRevision.
+ *
+ * \see gd::ObjectsContainersList
+ */
+class GD_CORE_API ObjectsStructureRevision {
+ public:
+  /**
+   * \brief Return the current revision.
+   */
+  static std::size_t Get() { return revision; };
+
+  /**
+   * \brief To be called after objects, their behaviors or objects groups
+   * were modified.
+   */
+  static void Increment() { revision++; };
+
+ private:
+  static std::atomic<std::size_t> revision;
+};
+
+}  // namespace gd
@@ -1118,6 +1118,8 @@ class GD_CORE_API Project {
   }
 
  private:
+  friend class ProjectExportOverlay;
+
   /**
    * Initialize from another game. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
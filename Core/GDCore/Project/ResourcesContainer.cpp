@@ -31,6 +31,7 @@ gd::String NormalizePathSeparator(const gd::String &path) {
 namespace gd {
 
 gd::String Resource::badStr;
+std::atomic<std::size_t> Resource::namesRevision(0);
 
 Resource ResourcesContainer::badResource;
 gd::String ResourcesContainer::badResourceName;
@@ -40,24 +41,19 @@ void ResourcesContainer::Init(const ResourcesContainer &other) {
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
+  resourcesIndex.Invalidate();
 }
 
 Resource &ResourcesContainer::GetResource(const gd::String &name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return *resources[i];
-  }
-
-  return badResource;
+  Resource *resource =
+      resourcesIndex.Find(name, resources, Resource::GetNamesRevision());
+  return resource ? *resource : badResource;
 }
 
 const Resource &ResourcesContainer::GetResource(const gd::String &name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return *resources[i];
-  }
-
-  return badResource;
+  const Resource *resource =
+      resourcesIndex.Find(name, resources, Resource::GetNamesRevision());
+  return resource ? *resource : badResource;
 }
 
 const gd::String &ResourcesContainer::GetResourceNameWithOrigin(
@@ -155,12 +151,8 @@ const gd::String Resource::javaScriptType = "javascript";
 const gd::String Resource::internalInGameEditorOnlySvgType = "internal-in-game-editor-only-svg";
 
 bool ResourcesContainer::HasResource(const gd::String &name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return true;
-  }
-
-  return false;
+  return resourcesIndex.Find(name, resources, Resource::GetNamesRevision()) !=
+         nullptr;
 }
 
 std::vector<gd::String> ResourcesContainer::GetAllResourceNames() const {
@@ -238,6 +230,8 @@ bool ResourcesContainer::AddResource(const gd::Resource &resource) {
     return false;
 
   resources.push_back(newResource);
+  resourcesIndex.OnItemInserted(
+      *newResource, resources, Resource::GetNamesRevision());
   return true;
 }
 
@@ -252,6 +246,7 @@ bool ResourcesContainer::AddResource(const gd::String &name,
   res->SetName(name);
 
   resources.push_back(res);
+  resourcesIndex.OnItemInserted(*res, resources, Resource::GetNamesRevision());
 
   return true;
 }
@@ -296,17 +291,23 @@ bool MoveResourceDownInList(std::vector<std::shared_ptr<Resource>> &resources,
 } // namespace
 
 bool ResourcesContainer::MoveResourceUpInList(const gd::String &name) {
+  resourcesIndex.OnItemsMoved();
   return gd::MoveResourceUpInList(resources, name);
 }
 
 bool ResourcesContainer::MoveResourceDownInList(const gd::String &name) {
+  resourcesIndex.OnItemsMoved();
   return gd::MoveResourceDownInList(resources, name);
 }
 
 std::size_t
 ResourcesContainer::GetResourcePosition(const gd::String &name) const {
+  const Resource *resource =
+      resourcesIndex.Find(name, resources, Resource::GetNamesRevision());
+  if (!resource) return gd::String::npos;
+
   for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
+    if (resources[i].get() == resource)
       return i;
   }
   return gd::String::npos;
@@ -334,16 +335,15 @@ void ResourcesContainer::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  resourcesIndex.OnItemsMoved();
 }
 
 std::shared_ptr<gd::Resource>
 ResourcesContainer::GetResourceSPtr(const gd::String &name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name)
-      return resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position == gd::String::npos) return std::shared_ptr<gd::Resource>();
 
-  return std::shared_ptr<gd::Resource>();
+  return resources[position];
 }
 
 void ResourcesContainer::RenameResource(const gd::String& oldName,
@@ -354,17 +354,24 @@ void ResourcesContainer::RenameResource(const gd::String& oldName,
 }
 
 void ResourcesContainer::RemoveResource(const gd::String &name) {
+  if (!HasResource(name)) return;
+
+  // Copy the name as it can be the one of a removed resource.
+  gd::String removedResourceName = name;
   for (std::size_t i = 0; i < resources.size();) {
     if (resources[i] != std::shared_ptr<Resource>() &&
-        resources[i]->GetName() == name)
+        resources[i]->GetName() == removedResourceName) {
       resources.erase(resources.begin() + i);
-    else
+      resourcesIndex.OnItemRemoved(
+          removedResourceName, resources, Resource::GetNamesRevision());
+    } else
       ++i;
   }
 }
 
 void ResourcesContainer::UnserializeFrom(const SerializerElement &element) {
   resources.clear();
+  resourcesIndex.Invalidate();
   const SerializerElement &resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
@@ -376,6 +383,7 @@ void ResourcesContainer::UnserializeFrom(const SerializerElement &element) {
     UnserializeResourceFrom(*resource, resourceElement);
     resources.push_back(resource);
   }
+  resourcesIndex.Invalidate();
 }
 
 void ResourcesContainer::UnserializeResourceFrom(
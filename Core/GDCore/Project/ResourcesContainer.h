@@ -5,11 +5,13 @@
  */
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 
 namespace gd {
 class Project;
@@ -46,12 +48,22 @@ public:
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String &name_) { name = name_; }
+  virtual void SetName(const gd::String &name_) {
+    // Naming a new resource is not a rename: it's not in a container yet.
+    if (!name.empty() && name != name_) namesRevision++;
+    name = name_;
+  }
 
   /** \brief Return the name of the resource.
    */
   virtual const gd::String &GetName() const { return name; }
 
+  /** \brief Return a number that changes every time a resource is renamed.
+   *
+   * \see gd::NameIndex
+   */
+  static std::size_t GetNamesRevision() { return namesRevision; }
+
   /** \brief Change the kind of the resource
    */
   virtual void SetKind(const gd::String &newKind) { kind = newKind; }
@@ -173,6 +185,7 @@ private:
                           ///< not automatically by GDevelop.
 
   static gd::String badStr;
+  static std::atomic<std::size_t> namesRevision;
 };
 
 /**
@@ -706,7 +719,10 @@ public:
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { resources.clear(); }
+  inline void Clear() {
+    resources.clear();
+    resourcesIndex.Invalidate();
+  }
 
   /**
    * \brief Add an already constructed resource.
@@ -789,6 +805,7 @@ private:
   SourceType sourceType = Unknown;
 
   std::vector<std::shared_ptr<Resource>> resources;
+  gd::NameIndex<gd::Resource> resourcesIndex;  ///< Find resources by name.
 
   static Resource badResource;
   static gd::String badResourceName;
@@ -15,82 +15,171 @@ size_t BinarySerializer::lastBinarySnapshotSize = 0;
 
 using NodeType = BinarySerializer::NodeType;
 
+namespace {
+const uint32_t magic = 0x47444253;  // "GDBS"
+const uint32_t version = 2;
+
+/**
+ * Flags stored after the version.
+ */
+enum Flags : uint8_t { HasChecksum = 0x01 };
+
+/**
+ * Compute the CRC-32 (as used by zlib and PNG) of the data.
+ */
+uint32_t ComputeChecksum(const uint8_t* data, size_t size) {
+  static const std::vector<uint32_t> table = []() {
+    std::vector<uint32_t> table(256);
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit)
+        crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+      table[i] = crc;
+    }
+    return table;
+  }();
+
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < size; ++i)
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return crc ^ 0xFFFFFFFF;
+}
+
+uint32_t ZigZagEncode(int32_t value) {
+  return (static_cast<uint32_t>(value) << 1) ^
+         static_cast<uint32_t>(value >> 31);
+}
+
+int32_t ZigZagDecode(uint32_t value) {
+  return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+}  // namespace
+
 void BinarySerializer::SerializeToBinaryBuffer(const SerializerElement& element,
-                                         std::vector<uint8_t>& outBuffer) {
+                                               std::vector<uint8_t>& outBuffer,
+                                               bool withChecksum) {
   // Reserve approximate size (heuristic: 1KB minimum)
   outBuffer.clear();
   outBuffer.reserve(1024);
 
-  // Write magic header and version
-  Write(outBuffer, static_cast<uint32_t>(0x47444253));  // "GDBS" magic
-  Write(outBuffer, static_cast<uint32_t>(1));           // Version 1
+  // Write magic header, version and flags
+  WriteLittleEndian(outBuffer, magic);
+  WriteLittleEndian(outBuffer, version);
+  WriteLittleEndian(outBuffer,
+                    static_cast<uint8_t>(withChecksum ? HasChecksum : 0));
 
   // Serialize the element tree
-  SerializeElement(element, outBuffer);
-}
+  std::unordered_map<gd::String, uint32_t> stringsTable;
+  SerializeElement(element, outBuffer, stringsTable);
 
-void BinarySerializer::SerializeElement(const SerializerElement& element,
-                                        std::vector<uint8_t>& buffer) {
-  Write(buffer, NodeType::Element);
+  if (withChecksum)
+    WriteLittleEndian(outBuffer,
+                      ComputeChecksum(outBuffer.data(), outBuffer.size()));
+}
 
+void BinarySerializer::SerializeElement(
+    const SerializerElement& element,
+    std::vector<uint8_t>& buffer,
+    std::unordered_map<gd::String, uint32_t>& stringsTable) {
   // Serialize value
   if (element.IsValueUndefined()) {
-    Write(buffer, NodeType::ValueUndefined);
+    buffer.push_back(static_cast<uint8_t>(NodeType::ValueUndefined));
   } else {
-    SerializeValue(element.GetValue(), buffer);
+    SerializeValue(element.GetValue(), buffer, stringsTable);
   }
 
   // Serialize attributes
   const auto& attributes = element.GetAllAttributes();
-  Write(buffer, static_cast<uint32_t>(attributes.size()));
+  WriteVarUint(buffer, attributes.size());
   for (const auto& attr : attributes) {
-    SerializeString(attr.first, buffer);
-    SerializeValue(attr.second, buffer);
+    SerializeString(attr.first, buffer, stringsTable);
+    SerializeValue(attr.second, buffer, stringsTable);
   }
 
   // Serialize array flags
-  Write(buffer, element.ConsideredAsArray());
-  SerializeString(element.ConsideredAsArrayOf(), buffer);
+  buffer.push_back(element.ConsideredAsArray() ? 1 : 0);
+  SerializeString(element.ConsideredAsArrayOf(), buffer, stringsTable);
 
   // Serialize children
   const auto& children = element.GetAllChildren();
-  Write(buffer, static_cast<uint32_t>(children.size()));
+  WriteVarUint(buffer, children.size());
   for (const auto& child : children) {
-    SerializeString(child.first, buffer);  // Child name
-    SerializeElement(*child.second, buffer);  // Child element (recursive)
+    SerializeString(child.first, buffer, stringsTable);  // Child name
+    SerializeElement(
+        *child.second, buffer, stringsTable);  // Child element (recursive)
   }
 }
 
-void BinarySerializer::SerializeValue(const SerializerValue& value,
-                                      std::vector<uint8_t>& buffer) {
+void BinarySerializer::SerializeValue(
+    const SerializerValue& value,
+    std::vector<uint8_t>& buffer,
+    std::unordered_map<gd::String, uint32_t>& stringsTable) {
   if (value.IsBoolean()) {
-    Write(buffer, NodeType::ValueBool);
-    Write(buffer, value.GetBool());
+    buffer.push_back(static_cast<uint8_t>(NodeType::ValueBool));
+    buffer.push_back(value.GetBool() ? 1 : 0);
   } else if (value.IsInt()) {
-    Write(buffer, NodeType::ValueInt);
-    Write(buffer, value.GetInt());
+    buffer.push_back(static_cast<uint8_t>(NodeType::ValueInt));
+    WriteVarUint(buffer, ZigZagEncode(value.GetInt()));
   } else if (value.IsDouble()) {
-    Write(buffer, NodeType::ValueDouble);
-    Write(buffer, value.GetDouble());
+    buffer.push_back(static_cast<uint8_t>(NodeType::ValueDouble));
+    double doubleValue = value.GetDouble();
+    uint64_t bits;
+    std::memcpy(&bits, &doubleValue, sizeof(bits));
+    WriteLittleEndian(buffer, bits);
   } else if (value.IsString()) {
-    Write(buffer, NodeType::ValueString);
-    SerializeString(value.GetString(), buffer);
+    buffer.push_back(static_cast<uint8_t>(NodeType::ValueString));
+    SerializeString(value.GetRawString(), buffer, stringsTable);
   } else {
     // Shouldn't happen, but handle gracefully
-    Write(buffer, NodeType::ValueUndefined);
+    buffer.push_back(static_cast<uint8_t>(NodeType::ValueUndefined));
   }
 }
 
-void BinarySerializer::SerializeString(const gd::String& str,
-                                       std::vector<uint8_t>& buffer) {
-  // Convert to UTF-8
-  std::string utf8 = str.ToUTF8();
+void BinarySerializer::SerializeString(
+    const gd::String& str,
+    std::vector<uint8_t>& buffer,
+    std::unordered_map<gd::String, uint32_t>& stringsTable) {
+  // Strings already written are replaced by their position in the strings
+  // table (plus one). A new string is written after a zero.
+  auto it = stringsTable.find(str);
+  if (it != stringsTable.end()) {
+    WriteVarUint(buffer, it->second + 1);
+    return;
+  }
 
-  // Write length + data
-  Write(buffer, static_cast<uint32_t>(utf8.size()));
+  uint32_t position = static_cast<uint32_t>(stringsTable.size());
+  stringsTable.emplace(str, position);
+
+  const std::string& utf8 = str.Raw();
+  WriteVarUint(buffer, 0);
+  WriteVarUint(buffer, utf8.size());
   buffer.insert(buffer.end(), utf8.begin(), utf8.end());
 }
 
+void BinarySerializer::WriteVarUint(std::vector<uint8_t>& buffer,
+                                    uint64_t value) {
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<uint8_t>(value));
+}
+
+bool BinarySerializer::ReadVarUint(const uint8_t*& ptr,
+                                   const uint8_t* end,
+                                   uint64_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (ptr >= end) return false;
+
+    uint8_t byte = *ptr++;
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+
+  return false;  // Too many bytes for a 64 bits integer
+}
+
 bool BinarySerializer::DeserializeFromBinaryBuffer(const uint8_t* buffer,
                                              size_t bufferSize,
                                              SerializerElement& outElement) {
@@ -98,26 +187,195 @@ bool BinarySerializer::DeserializeFromBinaryBuffer(const uint8_t* buffer,
   const uint8_t* end = buffer + bufferSize;
 
   // Read and verify magic header
-  uint32_t magic;
-  if (!Read(ptr, end, magic) || magic != 0x47444253) {
+  uint32_t bufferMagic;
+  if (!ReadLittleEndian(ptr, end, bufferMagic) || bufferMagic != magic) {
     gd::LogError("Failed to deserialize binary snapshot: invalid magic.");
     return false;  // Invalid magic
   }
 
   // Read version
-  uint32_t version;
-  if (!Read(ptr, end, version) || version != 1) {
+  uint32_t bufferVersion;
+  if (!ReadLittleEndian(ptr, end, bufferVersion) ||
+      (bufferVersion != 1 && bufferVersion != version)) {
     gd::LogError("Failed to deserialize binary snapshot: unsupported version.");
     return false;  // Unsupported version
   }
 
+  if (bufferVersion == 1) return DeserializeElementV1(ptr, end, outElement);
+
+  uint8_t flags;
+  if (!ReadLittleEndian(ptr, end, flags)) return false;
+
+  if (flags & HasChecksum) {
+    if (end - ptr < static_cast<std::ptrdiff_t>(sizeof(uint32_t))) return false;
+
+    end -= sizeof(uint32_t);
+    const uint8_t* checksumPtr = end;
+    uint32_t checksum;
+    if (!ReadLittleEndian(checksumPtr, checksumPtr + sizeof(uint32_t),
+                          checksum) ||
+        checksum != ComputeChecksum(buffer, end - buffer)) {
+      gd::LogError("Failed to deserialize binary snapshot: invalid checksum.");
+      return false;
+    }
+  }
+
   // Deserialize element tree
-  return DeserializeElement(ptr, end, outElement);
+  std::deque<gd::String> stringsTable;
+  if (!DeserializeElement(ptr, end, outElement, stringsTable) || ptr != end) {
+    gd::LogError("Failed to deserialize binary snapshot: invalid data.");
+    return false;
+  }
+
+  return true;
 }
 
-bool BinarySerializer::DeserializeElement(const uint8_t*& ptr,
-                                          const uint8_t* end,
-                                          SerializerElement& element) {
+bool BinarySerializer::DeserializeElement(
+    const uint8_t*& ptr,
+    const uint8_t* end,
+    SerializerElement& element,
+    std::deque<gd::String>& stringsTable) {
+  // Deserialize value
+  uint8_t valueType;
+  if (!ReadLittleEndian(ptr, end, valueType)) return false;
+
+  if (static_cast<NodeType>(valueType) != NodeType::ValueUndefined) {
+    SerializerValue value;
+    if (!DeserializeValue(
+            ptr, end, value, static_cast<NodeType>(valueType), stringsTable))
+      return false;
+    element.SetValue(value);
+  }
+
+  // Deserialize attributes
+  uint64_t attrCount;
+  if (!ReadVarUint(ptr, end, attrCount)) return false;
+
+  for (uint64_t i = 0; i < attrCount; ++i) {
+    const gd::String* attrName;
+    if (!DeserializeString(ptr, end, attrName, stringsTable)) return false;
+
+    SerializerValue attrValue;
+    uint8_t attrValueType;
+    if (!ReadLittleEndian(ptr, end, attrValueType)) return false;
+    if (!DeserializeValue(ptr,
+                          end,
+                          attrValue,
+                          static_cast<NodeType>(attrValueType),
+                          stringsTable))
+      return false;
+
+    // Set attribute based on type
+    if (attrValue.IsBoolean()) {
+      element.SetAttribute(*attrName, attrValue.GetBool());
+    } else if (attrValue.IsInt()) {
+      element.SetAttribute(*attrName, attrValue.GetInt());
+    } else if (attrValue.IsDouble()) {
+      element.SetAttribute(*attrName, attrValue.GetDouble());
+    } else if (attrValue.IsString()) {
+      element.SetAttribute(*attrName, attrValue.GetRawString());
+    }
+  }
+
+  // Deserialize array flags
+  uint8_t isArray;
+  if (!ReadLittleEndian(ptr, end, isArray)) return false;
+  if (isArray) element.ConsiderAsArray();
+
+  const gd::String* arrayOf;
+  if (!DeserializeString(ptr, end, arrayOf, stringsTable)) return false;
+  if (!arrayOf->empty()) {
+    element.ConsiderAsArrayOf(*arrayOf);
+  }
+
+  // Deserialize children
+  uint64_t childCount;
+  if (!ReadVarUint(ptr, end, childCount)) return false;
+
+  for (uint64_t i = 0; i < childCount; ++i) {
+    const gd::String* childName;
+    if (!DeserializeString(ptr, end, childName, stringsTable)) return false;
+
+    SerializerElement& child = element.AddChild(*childName);
+    if (!DeserializeElement(ptr, end, child, stringsTable)) return false;
+  }
+
+  return true;
+}
+
+bool BinarySerializer::DeserializeValue(const uint8_t*& ptr,
+                                        const uint8_t* end,
+                                        SerializerValue& value,
+                                        NodeType valueType,
+                                        std::deque<gd::String>& stringsTable) {
+  switch (valueType) {
+    case NodeType::ValueBool: {
+      uint8_t boolVal;
+      if (!ReadLittleEndian(ptr, end, boolVal)) return false;
+      value.SetBool(boolVal != 0);
+      break;
+    }
+    case NodeType::ValueInt: {
+      uint64_t intVal;
+      if (!ReadVarUint(ptr, end, intVal) || intVal > UINT32_MAX) return false;
+      value.SetInt(ZigZagDecode(static_cast<uint32_t>(intVal)));
+      break;
+    }
+    case NodeType::ValueDouble: {
+      uint64_t bits;
+      if (!ReadLittleEndian(ptr, end, bits)) return false;
+      double doubleVal;
+      std::memcpy(&doubleVal, &bits, sizeof(doubleVal));
+      value.SetDouble(doubleVal);
+      break;
+    }
+    case NodeType::ValueString: {
+      const gd::String* strVal;
+      if (!DeserializeString(ptr, end, strVal, stringsTable)) return false;
+      value.SetString(*strVal);
+      break;
+    }
+    case NodeType::ValueUndefined:
+      // Value remains undefined
+      break;
+    default:
+      return false;  // Unknown value type
+  }
+
+  return true;
+}
+
+bool BinarySerializer::DeserializeString(const uint8_t*& ptr,
+                                         const uint8_t* end,
+                                         const gd::String*& str,
+                                         std::deque<gd::String>& stringsTable) {
+  uint64_t position;
+  if (!ReadVarUint(ptr, end, position)) return false;
+
+  if (position != 0) {
+    if (position > stringsTable.size()) return false;
+
+    str = &stringsTable[position - 1];
+    return true;
+  }
+
+  uint64_t length;
+  if (!ReadVarUint(ptr, end, length)) return false;
+
+  if (length > static_cast<uint64_t>(end - ptr)) return false;
+
+  // References to the strings stay valid when the deque grows.
+  stringsTable.emplace_back();
+  stringsTable.back().Raw().assign(reinterpret_cast<const char*>(ptr), length);
+  ptr += length;
+
+  str = &stringsTable.back();
+  return true;
+}
+
+bool BinarySerializer::DeserializeElementV1(const uint8_t*& ptr,
+                                            const uint8_t* end,
+                                            SerializerElement& element) {
   NodeType nodeType;
   if (!Read(ptr, end, nodeType) || nodeType != NodeType::Element) {
     gd::LogError("Failed to deserialize binary snapshot: invalid node type.");
@@ -133,7 +391,7 @@ bool BinarySerializer::DeserializeElement(const uint8_t*& ptr,
 
   if (valueType != NodeType::ValueUndefined) {
     SerializerValue value;
-    if (!DeserializeValue(ptr, end, value, valueType)) return false;
+    if (!DeserializeValueV1(ptr, end, value, valueType)) return false;
     element.SetValue(value);
   }
 
@@ -143,12 +401,12 @@ bool BinarySerializer::DeserializeElement(const uint8_t*& ptr,
 
   for (uint32_t i = 0; i < attrCount; ++i) {
     gd::String attrName;
-    if (!DeserializeString(ptr, end, attrName)) return false;
+    if (!DeserializeStringV1(ptr, end, attrName)) return false;
 
     SerializerValue attrValue;
     NodeType attrValueType;
     if (!Read(ptr, end, attrValueType)) return false;
-    if (!DeserializeValue(ptr, end, attrValue, attrValueType)) return false;
+    if (!DeserializeValueV1(ptr, end, attrValue, attrValueType)) return false;
 
     // Set attribute based on type
     if (attrValue.IsBoolean()) {
@@ -168,7 +426,7 @@ bool BinarySerializer::DeserializeElement(const uint8_t*& ptr,
   if (isArray) element.ConsiderAsArray();
 
   gd::String arrayOf;
-  if (!DeserializeString(ptr, end, arrayOf)) return false;
+  if (!DeserializeStringV1(ptr, end, arrayOf)) return false;
   if (!arrayOf.empty()) {
     element.ConsiderAsArrayOf(arrayOf);
   }
@@ -179,19 +437,19 @@ bool BinarySerializer::DeserializeElement(const uint8_t*& ptr,
 
   for (uint32_t i = 0; i < childCount; ++i) {
     gd::String childName;
-    if (!DeserializeString(ptr, end, childName)) return false;
+    if (!DeserializeStringV1(ptr, end, childName)) return false;
 
     SerializerElement& child = element.AddChild(childName);
-    if (!DeserializeElement(ptr, end, child)) return false;
+    if (!DeserializeElementV1(ptr, end, child)) return false;
   }
 
   return true;
 }
 
-bool BinarySerializer::DeserializeValue(const uint8_t*& ptr,
-                                        const uint8_t* end,
-                                        SerializerValue& value,
-                                        NodeType valueType) {
+bool BinarySerializer::DeserializeValueV1(const uint8_t*& ptr,
+                                          const uint8_t* end,
+                                          SerializerValue& value,
+                                          NodeType valueType) {
   switch (valueType) {
     case NodeType::ValueBool: {
       bool boolVal;
@@ -213,7 +471,7 @@ bool BinarySerializer::DeserializeValue(const uint8_t*& ptr,
     }
     case NodeType::ValueString: {
       gd::String strVal;
-      if (!DeserializeString(ptr, end, strVal)) return false;
+      if (!DeserializeStringV1(ptr, end, strVal)) return false;
       value.SetString(strVal);
       break;
     }
@@ -227,9 +485,9 @@ bool BinarySerializer::DeserializeValue(const uint8_t*& ptr,
   return true;
 }
 
-bool BinarySerializer::DeserializeString(const uint8_t*& ptr,
-                                         const uint8_t* end,
-                                         gd::String& str) {
+bool BinarySerializer::DeserializeStringV1(const uint8_t*& ptr,
+                                           const uint8_t* end,
+                                           gd::String& str) {
   uint32_t length;
   if (!Read(ptr, end, length)) return false;
 
@@ -8,6 +8,8 @@
 
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Serialization/SerializerElement.h"
@@ -17,8 +19,13 @@ namespace gd {
 /**
  * \brief Fast binary serialization/deserialization for SerializerElement trees.
  *
- * This format is optimized for speed and compactness, not for human readability
- * or long-term storage. For transferring data between "threads" (web workers).
+ * This format is optimized for speed and compactness, not for human
+ * readability. It is used for transferring data between "threads" (web
+ * workers), and can be used for caches stored on disk: buffers start with a
+ * version, numbers are stored in little-endian, strings are only stored once
+ * and buffers can end with a checksum to detect corrupted data.
+ *
+ * Buffers written with the first version of the format can still be read.
  */
 class GD_CORE_API BinarySerializer {
  public:
@@ -27,9 +34,13 @@ class GD_CORE_API BinarySerializer {
    *
    * \param element The root element to serialize
    * \param outBuffer Output buffer that will contain the binary data
+   * \param withChecksum If true, a checksum of the data is added at the end
+   * of the buffer, so that corrupted data is detected when deserializing it
+   * (useful for buffers stored on disk).
    */
   static void SerializeToBinaryBuffer(const SerializerElement& element,
-                                std::vector<uint8_t>& outBuffer);
+                                      std::vector<uint8_t>& outBuffer,
+                                      bool withChecksum = false);
 
   /**
    * \brief Deserialize a binary buffer back to a SerializerElement tree.
@@ -83,33 +94,71 @@ class GD_CORE_API BinarySerializer {
 
  private:
   // Internal serialization
-  static void SerializeElement(const SerializerElement& element,
-                               std::vector<uint8_t>& buffer);
-  static void SerializeValue(const SerializerValue& value,
-                             std::vector<uint8_t>& buffer);
-  static void SerializeString(const gd::String& str,
-                              std::vector<uint8_t>& buffer);
+  static void SerializeElement(
+      const SerializerElement& element,
+      std::vector<uint8_t>& buffer,
+      std::unordered_map<gd::String, uint32_t>& stringsTable);
+  static void SerializeValue(
+      const SerializerValue& value,
+      std::vector<uint8_t>& buffer,
+      std::unordered_map<gd::String, uint32_t>& stringsTable);
+  static void SerializeString(
+      const gd::String& str,
+      std::vector<uint8_t>& buffer,
+      std::unordered_map<gd::String, uint32_t>& stringsTable);
 
   // Internal deserialization
   static bool DeserializeElement(const uint8_t*& ptr,
                                  const uint8_t* end,
-                                 SerializerElement& element);
+                                 SerializerElement& element,
+                                 std::deque<gd::String>& stringsTable);
   static bool DeserializeValue(const uint8_t*& ptr,
                                const uint8_t* end,
                                SerializerValue& value,
-                               NodeType valueType);
+                               NodeType valueType,
+                               std::deque<gd::String>& stringsTable);
   static bool DeserializeString(const uint8_t*& ptr,
                                 const uint8_t* end,
-                                gd::String& str);
+                                const gd::String*& str,
+                                std::deque<gd::String>& stringsTable);
+
+  // Internal deserialization of the first version of the format
+  static bool DeserializeElementV1(const uint8_t*& ptr,
+                                   const uint8_t* end,
+                                   SerializerElement& element);
+  static bool DeserializeValueV1(const uint8_t*& ptr,
+                                 const uint8_t* end,
+                                 SerializerValue& value,
+                                 NodeType valueType);
+  static bool DeserializeStringV1(const uint8_t*& ptr,
+                                  const uint8_t* end,
+                                  gd::String& str);
+
+  // Helpers to write and read unsigned integers, in little-endian
+  template <typename T>
+  static void WriteLittleEndian(std::vector<uint8_t>& buffer, T value) {
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+      buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
 
-  // Helper to write primitive types
   template <typename T>
-  static void Write(std::vector<uint8_t>& buffer, const T& value) {
-    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
-    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  static bool ReadLittleEndian(const uint8_t*& ptr, const uint8_t* end,
+                               T& value) {
+    if (end - ptr < static_cast<std::ptrdiff_t>(sizeof(T))) return false;
+    value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+      value |= static_cast<T>(ptr[i]) << (8 * i);
+    ptr += sizeof(T);
+    return true;
   }
 
-  // Helper to read primitive types
+  // Helpers to write and read variable length unsigned integers (LEB128)
+  static void WriteVarUint(std::vector<uint8_t>& buffer, uint64_t value);
+  static bool ReadVarUint(const uint8_t*& ptr, const uint8_t* end,
+                          uint64_t& value);
+
+  // Helper to read primitive types, in the native byte order (first version
+  // of the format)
   template <typename T>
   static bool Read(const uint8_t*& ptr, const uint8_t* end, T& value) {
     if (ptr + sizeof(T) > end) return false;
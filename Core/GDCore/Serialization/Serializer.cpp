@@ -19,6 +19,9 @@
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/reader.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 
 using namespace rapidjson;
 
@@ -66,6 +69,60 @@ void RapidJsonValueToElement(const Value& value,
   }
 }
 
+/**
+ * Call \a callback with the name and the value (either an attribute value or a
+ * child element) of each member of an element which is an object, in the order
+ * they must be written in JSON.
+ */
+template <typename Callback>
+void ForEachObjectMember(const gd::SerializerElement& element,
+                         Callback callback) {
+  const auto& attributes = element.GetAllAttributes();
+  const auto& children = element.GetAllChildren();
+
+  if (gd::Serializer::IsCanonicalMode()) {
+    // In canonical mode, merge attributes and children into a single
+    // alphabetically-sorted sequence so that the resulting JSON has
+    // stable, alphabetical key order. Attributes are stored in a
+    // std::map (already sorted) but children are stored in insertion
+    // order; we re-sort the union here.
+    //
+    // Children with the same name (rare, but allowed) keep their
+    // relative insertion order thanks to std::multimap stability.
+    //
+    // Exactly one of attributeValue / childElement is non-null per
+    // entry; we discriminate on which pointer is set.
+    struct Entry {
+      const SerializerValue* attributeValue;
+      const gd::SerializerElement* childElement;
+    };
+    std::multimap<gd::String, Entry> sortedEntries;
+
+    for (const auto& attribute : attributes) {
+      sortedEntries.emplace(attribute.first, Entry{&attribute.second, nullptr});
+    }
+    for (const auto& child : children) {
+      sortedEntries.emplace(child.first, Entry{nullptr, child.second.get()});
+    }
+
+    for (const auto& entry : sortedEntries) {
+      // Defensive: skip malformed entries instead of dereferencing null.
+      if (entry.second.attributeValue == nullptr &&
+          entry.second.childElement == nullptr)
+        continue;
+
+      callback(entry.first,
+               entry.second.attributeValue,
+               entry.second.childElement);
+    }
+  } else {
+    for (const auto& attribute : attributes)
+      callback(attribute.first, &attribute.second, nullptr);
+    for (const auto& child : children)
+      callback(child.first, nullptr, child.second.get());
+  }
+}
+
 void ElementToRapidJson(const gd::SerializerElement& element,
                         Value& value,
                         Document::AllocatorType& allocator) {
@@ -96,75 +153,188 @@ void ElementToRapidJson(const gd::SerializerElement& element,
   } else {
     value.SetObject();
 
-    const auto& attributes = element.GetAllAttributes();
-    const auto& children = element.GetAllChildren();
+    ForEachObjectMember(
+        element,
+        [&](const gd::String& name,
+            const SerializerValue* attributeValue,
+            const gd::SerializerElement* childElement) {
+          Value nameValue(name.c_str(),
+                          allocator);  // Copying the name is required.
+          Value childValue;
+          if (attributeValue != nullptr) {
+            // Implicit conversion SerializerValue -> SerializerElement.
+            ElementToRapidJson(*attributeValue, childValue, allocator);
+          } else {
+            ElementToRapidJson(*childElement, childValue, allocator);
+          }
+          value.AddMember(nameValue, childValue, allocator);
+        });
+  }
+}
 
-    if (gd::Serializer::IsCanonicalMode()) {
-      // In canonical mode, merge attributes and children into a single
-      // alphabetically-sorted sequence so that the resulting JSON has
-      // stable, alphabetical key order. Attributes are stored in a
-      // std::map (already sorted) but children are stored in insertion
-      // order; we re-sort the union here.
-      //
-      // Children with the same name (rare, but allowed) keep their
-      // relative insertion order thanks to std::multimap stability.
-      //
-      // Exactly one of attributeValue / childElement is non-null per
-      // entry; we discriminate on which pointer is set.
-      struct Entry {
-        const SerializerValue* attributeValue;
-        const gd::SerializerElement* childElement;
-      };
-      std::multimap<gd::String, Entry> sortedEntries;
-
-      for (const auto& attribute : attributes) {
-        sortedEntries.emplace(
-            attribute.first,
-            Entry{&attribute.second, nullptr});
-      }
-      for (const auto& child : children) {
-        sortedEntries.emplace(
-            child.first,
-            Entry{nullptr, child.second.get()});
-      }
-
-      for (const auto& entry : sortedEntries) {
-        Value name(entry.first.c_str(), allocator);
-        Value childValue;
-        if (entry.second.attributeValue != nullptr) {
-          // Implicit conversion SerializerValue -> SerializerElement.
-          ElementToRapidJson(
-              *entry.second.attributeValue, childValue, allocator);
-        } else if (entry.second.childElement != nullptr) {
-          ElementToRapidJson(
-              *entry.second.childElement, childValue, allocator);
-        } else {
-          // Defensive: skip malformed entries instead of dereferencing null.
-          continue;
-        }
-        value.AddMember(name, childValue, allocator);
-      }
-    } else {
-      for (const auto& attribute : attributes) {
-        Value name(attribute.first.c_str(),
-                   allocator);  // Copying the name is required.
-        Value childValue;
-        ElementToRapidJson(attribute.second, childValue, allocator);
-        value.AddMember(name, childValue, allocator);
-      }
-      for (const auto& child : children) {
-        Value name(child.first.c_str(),
-                   allocator);  // Copying the name is required.
-        Value childValue;
-        ElementToRapidJson(*child.second, childValue, allocator);
-        value.AddMember(name, childValue, allocator);
-      }
-    }
+/**
+ * \brief Build a gd::SerializerElement from the events sent by a RapidJSON
+ * reader, without creating a RapidJSON document first.
+ */
+class SerializerElementReaderHandler
+    : public BaseReaderHandler<UTF8<>, SerializerElementReaderHandler> {
+ public:
+  SerializerElementReaderHandler(gd::SerializerElement& rootElement_,
+                                 bool numbersAsDoubles_)
+      : rootElement(rootElement_), numbersAsDoubles(numbersAsDoubles_){};
+
+  bool Null() {
+    NextElement();
+    return true;
+  }
+  bool Bool(bool value) {
+    NextElement().SetBoolValue(value);
+    return true;
+  }
+  bool Int(int value) {
+    SetInteger(NextElement(), value);
+    return true;
+  }
+  bool Uint(unsigned value) {
+    SetInteger(NextElement(), value);
+    return true;
+  }
+  bool Int64(int64_t value) {
+    SetInteger(NextElement(), value);
+    return true;
+  }
+  bool Uint64(uint64_t value) {
+    SetInteger(NextElement(), value);
+    return true;
+  }
+  bool Double(double value) {
+    NextElement().SetValue(value);
+    return true;
+  }
+  bool String(const char* value, SizeType length, bool copy) {
+    NextElement().SetStringValue(value);
+    return true;
+  }
+  bool StartObject() {
+    parentElements.push_back(&NextElement());
+    return true;
+  }
+  bool Key(const char* name, SizeType length, bool copy) {
+    key = name;
+    return true;
+  }
+  bool EndObject(SizeType membersCount) {
+    parentElements.pop_back();
+    return true;
+  }
+  bool StartArray() {
+    gd::SerializerElement& element = NextElement();
+    element.ConsiderAsArray();
+    parentElements.push_back(&element);
+    return true;
+  }
+  bool EndArray(SizeType elementsCount) {
+    parentElements.pop_back();
+    return true;
+  }
+
+ private:
+  /**
+   * Return the element for the value being read: the root element, or a new
+   * child of the object or array being read.
+   */
+  gd::SerializerElement& NextElement() {
+    if (parentElements.empty()) return rootElement;
+
+    gd::SerializerElement& parentElement = *parentElements.back();
+    return parentElement.ConsideredAsArray() ? parentElement.AddChild("")
+                                             : parentElement.AddChild(key);
+  }
+
+  template <typename T>
+  void SetInteger(gd::SerializerElement& element, T value) {
+    if (numbersAsDoubles)
+      element.SetDoubleValue(value);
+    else
+      element.SetIntValue(value);
+  }
+
+  gd::SerializerElement& rootElement;
+  bool numbersAsDoubles;  ///< If true, integers are stored as doubles.
+  std::vector<gd::SerializerElement*> parentElements;
+  gd::String key;  ///< The name of the next member of the object being read.
+};
+
+void WriteValue(const SerializerValue& value, Writer<StringBuffer>& writer) {
+  if (value.IsBoolean())
+    writer.Bool(value.GetBool());
+  else if (value.IsDouble())
+    writer.Double(value.GetDouble());
+  else if (value.IsInt())
+    writer.Int(value.GetInt());
+  else if (value.IsString())
+    writer.String(value.GetRawString().c_str());
+  else
+    writer.Null();
+}
+
+void WriteElement(const gd::SerializerElement& element,
+                  Writer<StringBuffer>& writer) {
+  if (!element.IsValueUndefined()) {
+    WriteValue(element.GetValue(), writer);
+  } else if (element.ConsideredAsArray()) {
+    writer.StartArray();
+    for (const auto& child : element.GetAllChildren())
+      WriteElement(*child.second, writer);
+    writer.EndArray();
+  } else {
+    writer.StartObject();
+    ForEachObjectMember(element,
+                        [&](const gd::String& name,
+                            const SerializerValue* attributeValue,
+                            const gd::SerializerElement* childElement) {
+                          writer.Key(name.c_str());
+                          if (attributeValue != nullptr)
+                            WriteValue(*attributeValue, writer);
+                          else
+                            WriteElement(*childElement, writer);
+                        });
+    writer.EndObject();
   }
 }
 }  // namespace
 
 SerializerElement Serializer::FromJSON(const char* json) {
+  SerializerElement element;
+  if (json[0] != '\0') UnserializeFromJSON(json, element, false);
+
+  return element;
+}
+
+bool Serializer::UnserializeFromJSON(const char* json,
+                                     SerializerElement& element,
+                                     bool numbersAsDoubles) {
+  SerializerElementReaderHandler handler(element, numbersAsDoubles);
+  Reader reader;
+  StringStream stream(json);
+  if (reader.Parse(stream, handler).IsError()) {
+    std::cout << "TODO: error while parsing" << std::endl;
+    element = SerializerElement();
+    return false;
+  }
+
+  return true;
+}
+
+gd::String Serializer::ToJSON(const SerializerElement& element) {
+  StringBuffer buffer;
+  Writer<StringBuffer> writer(buffer);
+  WriteElement(element, writer);
+
+  return buffer.GetString();  // Temporary copy
+}
+
+SerializerElement Serializer::FromJSONUsingDocument(const char* json) {
   SerializerElement element;
   size_t len = strlen(json);
   if (len != 0) {
@@ -186,7 +356,7 @@ SerializerElement Serializer::FromJSON(const char* json) {
   return element;
 }
 
-gd::String Serializer::ToJSON(const SerializerElement& element) {
+gd::String Serializer::ToJSONUsingDocument(const SerializerElement& element) {
   Document document;
   Document::AllocatorType& allocator = document.GetAllocator();
 
@@ -41,6 +41,9 @@ class GD_CORE_API Serializer {
 
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
+   *
+   * The element is built while the JSON is parsed, without an intermediate
+   * RapidJSON document.
    */
   static SerializerElement FromJSON(const char* json);
 
@@ -50,6 +53,52 @@ class GD_CORE_API Serializer {
   static SerializerElement FromJSON(const gd::String& json) {
     return FromJSON(json.c_str());
   }
+
+  /**
+   * \brief Unserialize a JSON string into an empty gd::SerializerElement.
+   *
+   * This is used by GDevelop.js to convert a whole JavaScript object (as
+   * JSON) to a gd::SerializerElement with a single call.
+   *
+   * \param json The JSON string.
+   * \param element The element to fill.
+   * \param numbersAsDoubles If true, all numbers are stored as doubles, like
+   * JavaScript numbers. Otherwise, integers are stored as ints.
+   * \return false if the JSON could not be parsed (the element is then left
+   * empty).
+   */
+  static bool UnserializeFromJSON(const char* json,
+                                  SerializerElement& element,
+                                  bool numbersAsDoubles);
+
+  /**
+   * \brief Serialize a gd::SerializerElement to a JSON string, building a
+   * RapidJSON document first.
+   *
+   * \note ToJSON writes the JSON directly and should be preferred. This is
+   * kept to compare both in benchmarks.
+   */
+  static gd::String ToJSONUsingDocument(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON string, parsing it
+   * into a RapidJSON document first.
+   *
+   * \note FromJSON builds the element directly while parsing, using less
+   * memory, and should be preferred. This is kept to compare both in
+   * benchmarks.
+   */
+  static SerializerElement FromJSONUsingDocument(const char* json);
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON string, parsing it
+   * into a RapidJSON document first.
+   *
+   * \see gd::Serializer::FromJSONUsingDocument
+   */
+  static SerializerElement FromJSONUsingDocument(const gd::String& json) {
+    return FromJSONUsingDocument(json.c_str());
+  }
   ///@}
 
   /** \name Canonical serialization mode.
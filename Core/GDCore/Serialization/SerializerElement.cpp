@@ -1,12 +1,21 @@
 #include "GDCore/Serialization/SerializerElement.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 namespace gd {
 
+namespace {
+/**
+ * The number of children from which an element indexes its children by name.
+ */
+constexpr std::size_t childrenIndexMinimumCount = 16;
+}  // namespace
+
 SerializerElement SerializerElement::nullElement;
 
 SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
@@ -72,9 +81,10 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
   return *this;
 }
 
-bool SerializerElement::GetBoolAttribute(const gd::String& name,
-                                         bool defaultValue,
-                                         gd::String deprecatedName) const {
+bool SerializerElement::GetBoolAttribute(
+    const gd::String& name,
+    bool defaultValue,
+    const gd::String& deprecatedName) const {
   if (attributes.find(name) != attributes.end()) {
     return attributes.find(name)->second.GetBool();
   } else if (!deprecatedName.empty() &&
@@ -92,10 +102,10 @@ bool SerializerElement::GetBoolAttribute(const gd::String& name,
   return defaultValue;
 }
 
-gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
+gd::String SerializerElement::GetStringAttribute(
     const gd::String& name,
-    gd::String defaultValue,
-    gd::String deprecatedName) const {
+    const gd::String& defaultValue,
+    const gd::String& deprecatedName) const {
   if (attributes.find(name) != attributes.end())
     return attributes.find(name)->second.GetString();
   else if (!deprecatedName.empty() &&
@@ -111,9 +121,10 @@ gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
   return defaultValue;
 }
 
-int SerializerElement::GetIntAttribute(const gd::String& name,
-                                       int defaultValue,
-                                       gd::String deprecatedName) const {
+int SerializerElement::GetIntAttribute(
+    const gd::String& name,
+    int defaultValue,
+    const gd::String& deprecatedName) const {
   if (attributes.find(name) != attributes.end())
     return attributes.find(name)->second.GetInt();
   else if (!deprecatedName.empty() &&
@@ -129,9 +140,10 @@ int SerializerElement::GetIntAttribute(const gd::String& name,
   return defaultValue;
 }
 
-double SerializerElement::GetDoubleAttribute(const gd::String& name,
-                                             double defaultValue,
-                                             gd::String deprecatedName) const {
+double SerializerElement::GetDoubleAttribute(
+    const gd::String& name,
+    double defaultValue,
+    const gd::String& deprecatedName) const {
   if (attributes.find(name) != attributes.end())
     return attributes.find(name)->second.GetDouble();
   else if (!deprecatedName.empty() &&
@@ -151,28 +163,60 @@ bool SerializerElement::HasAttribute(const gd::String& name) const {
   return attributes.find(name) != attributes.end();
 }
 
-SerializerElement& SerializerElement::AddChild(gd::String name) {
-  if (isArray) {
-    if (name != arrayOf) {
-      std::cout << "WARNING: Adding a child, to a SerializerElement which is "
-                   "considered as an array, with a name ("
-                << name << ") which is not the same as the array elements ("
-                << arrayOf << "). Child was renamed." << std::endl;
-      name = arrayOf;
+void SerializerElement::ConsiderAsArrayOf(
+    const gd::String& name, const gd::String& deprecatedName) const {
+  ConsiderAsArray();
+  if (arrayOf == name && deprecatedArrayOf == deprecatedName) return;
+
+  arrayOf = name;
+  deprecatedArrayOf = deprecatedName;
+  onlyArrayElements = true;
+  for (const auto& child : children) {
+    if (!child.second || !IsArrayElementName(child.first)) {
+      onlyArrayElements = false;
+      break;
     }
   }
+}
+
+std::size_t SerializerElement::GetIndexedChildPosition(
+    const gd::String& name) const {
+  auto it = childrenIndex->find(name);
+  return it != childrenIndex->end() ? it->second : gd::String::npos;
+}
+
+void SerializerElement::IndexLastChild() {
+  if (childrenIndex) {
+    childrenIndex->emplace(children.back().first, children.size() - 1);
+  } else if (children.size() >= childrenIndexMinimumCount) {
+    childrenIndex =
+        gd::make_unique<std::unordered_map<gd::String, std::size_t>>();
+    childrenIndex->reserve(children.size() * 2);
+    for (std::size_t i = 0; i < children.size(); ++i)
+      childrenIndex->emplace(children[i].first, i);
+  }
+}
+
+SerializerElement& SerializerElement::AddChild(const gd::String& name) {
+  if (isArray && name != arrayOf) {
+    std::cout << "WARNING: Adding a child, to a SerializerElement which is "
+                 "considered as an array, with a name ("
+              << name << ") which is not the same as the array elements ("
+              << arrayOf << "). Child was renamed." << std::endl;
+    return AddChild(arrayOf);
+  }
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
   if (!isArray && HasChild(name)) {
     return GetChild(name);
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
+  std::shared_ptr<SerializerElement> newElement =
+      std::make_shared<SerializerElement>();
   children.push_back(std::make_pair(name, newElement));
+  if (!IsArrayElementName(name)) onlyArrayElements = false;
+  IndexLastChild();
 
   return *newElement;
 }
@@ -185,6 +229,14 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
+  if (onlyArrayElements) {
+    if (index < children.size()) return *children[index].second;
+
+    std::cout << "ERROR: Requested out of bound child at index " << index
+              << std::endl;
+    return nullElement;
+  }
+
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
@@ -205,15 +257,29 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
 }
 
 SerializerElement& SerializerElement::GetChild(
-    gd::String name, std::size_t index, gd::String deprecatedName) const {
-  if (isArray) {
-    if (name != arrayOf) {
-      std::cout << "WARNING: Getting a child, from a SerializerElement which "
-                   "is considered as an array, with a name ("
-                << name << ") which is not the same as the array elements ("
-                << arrayOf << ")." << std::endl;
-      name = arrayOf;
-    }
+    const gd::String& name,
+    std::size_t index,
+    const gd::String& deprecatedName) const {
+  if (isArray && name != arrayOf) {
+    std::cout << "WARNING: Getting a child, from a SerializerElement which "
+                 "is considered as an array, with a name ("
+              << name << ") which is not the same as the array elements ("
+              << arrayOf << ")." << std::endl;
+    return GetChild(arrayOf, index, deprecatedName);
+  }
+
+  if (isArray && onlyArrayElements && deprecatedName == deprecatedArrayOf)
+    return GetChild(index);
+
+  if (!isArray && index == 0 && childrenIndex) {
+    std::size_t position = GetIndexedChildPosition(name);
+    if (!deprecatedName.empty())
+      position = std::min(position, GetIndexedChildPosition(deprecatedName));
+    if (position != gd::String::npos) return *children[position].second;
+
+    std::cout << "Child " << name
+              << " not found in SerializerElement::GetChild" << std::endl;
+    return nullElement;
   }
 
   std::size_t currentIndex = 0;
@@ -235,8 +301,8 @@ SerializerElement& SerializerElement::GetChild(
 }
 
 SerializerElement &
-SerializerElement::GetOrCreateChild(gd::String name,
-                                    gd::String deprecatedName) {
+SerializerElement::GetOrCreateChild(const gd::String &name,
+                                    const gd::String &deprecatedName) {
   if (!HasChild(name)) {
     AddChild(name);
   }
@@ -244,26 +310,29 @@ SerializerElement::GetOrCreateChild(gd::String name,
 }
 
 std::size_t SerializerElement::GetChildrenCount(
-    gd::String name, gd::String deprecatedName) const {
-  if (name.empty()) {
-    if (!isArray) {
-      std::cout
-          << "ERROR: Getting children count without specifying name, from a "
-             "SerializerElement which is NOT considered as an array."
-          << std::endl;
-      return 0;
-    }
-
-    name = arrayOf;
-    deprecatedName = deprecatedArrayOf;
+    const gd::String& name, const gd::String& deprecatedName) const {
+  if (name.empty() && !isArray) {
+    std::cout << "ERROR: Getting children count without specifying name, from a "
+                 "SerializerElement which is NOT considered as an array."
+              << std::endl;
+    return 0;
   }
 
+  const gd::String& childrenName = name.empty() ? arrayOf : name;
+  const gd::String& childrenDeprecatedName =
+      name.empty() ? deprecatedArrayOf : deprecatedName;
+  if (isArray && onlyArrayElements && childrenName == arrayOf &&
+      childrenDeprecatedName == deprecatedArrayOf)
+    return children.size();
+
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
 
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
+    if (children[i].first == childrenName ||
+        (isArray && children[i].first.empty()) ||
+        (!childrenDeprecatedName.empty() &&
+         children[i].first == childrenDeprecatedName))
       currentIndex++;
   }
 
@@ -271,7 +340,13 @@ std::size_t SerializerElement::GetChildrenCount(
 }
 
 bool SerializerElement::HasChild(const gd::String& name,
-                                 gd::String deprecatedName) const {
+                                 const gd::String& deprecatedName) const {
+  if (childrenIndex) {
+    return GetIndexedChildPosition(name) != gd::String::npos ||
+           (!deprecatedName.empty() &&
+            GetIndexedChildPosition(deprecatedName) != gd::String::npos);
+  }
+
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
 
@@ -284,6 +359,14 @@ bool SerializerElement::HasChild(const gd::String& name,
 }
 
 void SerializerElement::RemoveChild(const gd::String& name) {
+  if (childrenIndex) {
+    if (GetIndexedChildPosition(name) == gd::String::npos) return;
+
+    // Positions of the next children change: the index is rebuilt when a
+    // child is added.
+    childrenIndex.reset();
+  }
+
   for (size_t i = 0; i < children.size();) {
     if (children[i].first == name)
       children.erase(children.begin() + i);
@@ -295,6 +378,8 @@ void SerializerElement::RemoveChild(const gd::String& name) {
 void SerializerElement::Clear() {
   children.clear();
   attributes.clear();
+  onlyArrayElements = true;
+  childrenIndex.reset();
 }
 
 bool SerializerElement::IsEmpty() {
@@ -311,16 +396,21 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   attributes = other.attributes;
 
   children.clear();
+  children.reserve(other.children.size());
   for (const auto& child : other.children) {
-    children.push_back(
-        std::make_pair(child.first,
-                       std::shared_ptr<SerializerElement>(
-                           new SerializerElement(*child.second))));
+    children.push_back(std::make_pair(
+        child.first, std::make_shared<SerializerElement>(*child.second)));
   }
 
   isArray = other.isArray;
   arrayOf = other.arrayOf;
   deprecatedArrayOf = other.deprecatedArrayOf;
+  onlyArrayElements = other.onlyArrayElements;
+  childrenIndex =
+      other.childrenIndex
+          ? gd::make_unique<std::unordered_map<gd::String, std::size_t>>(
+                *other.childrenIndex)
+          : nullptr;
 }
 
 void SerializerElement::SetMultilineStringValue(const gd::String& value) {
@@ -331,6 +421,8 @@ void SerializerElement::SetMultilineStringValue(const gd::String& value) {
 
   std::vector<gd::String> lines = value.Split('\n');
   children.clear();
+  onlyArrayElements = true;
+  childrenIndex.reset();
   ConsiderAsArrayOf("");
   for (const auto& line : lines) {
     AddChild("").SetStringValue(line);
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Serialization/SerializerValue.h"
@@ -28,9 +29,11 @@ namespace gd {
  * It also has specialized methods in GDevelop.js (see postjs.js) to be
  * converted to a JavaScript object.
  *
- * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
- * is not appropriated for a use in game where fast access is required.
+ * \note Children are stored with their order preserved. Elements with a lot
+ * of children keep an index of them by name, and children of arrays are
+ * accessed directly by their position, but removing a child is still
+ * O(number of children). This class is not appropriated for a use in game
+ * where fast access is required.
  *
  * \see gd::Serializer
  */
@@ -287,7 +290,7 @@ class GD_CORE_API SerializerElement {
    */
   bool GetBoolAttribute(const gd::String &name,
                         bool defaultValue = false,
-                        gd::String deprecatedName = "") const;
+                        const gd::String &deprecatedName = "") const;
 
   /**
    * Get the value of an attribute being a string.
@@ -297,8 +300,8 @@ class GD_CORE_API SerializerElement {
    * used if the first one doesn't exist.
    */
   gd::String GetStringAttribute(const gd::String &name,
-                                gd::String defaultValue = "",
-                                gd::String deprecatedName = "") const;
+                                const gd::String &defaultValue = "",
+                                const gd::String &deprecatedName = "") const;
 
   /**
    * Get the value of an attribute being an int.
@@ -309,7 +312,7 @@ class GD_CORE_API SerializerElement {
    */
   int GetIntAttribute(const gd::String &name,
                       int defaultValue = 0,
-                      gd::String deprecatedName = "") const;
+                      const gd::String &deprecatedName = "") const;
 
   /**
    * Get the value of an attribute being a double.
@@ -320,7 +323,7 @@ class GD_CORE_API SerializerElement {
    */
   double GetDoubleAttribute(const gd::String &name,
                             double defaultValue = 0.0,
-                            gd::String deprecatedName = "") const;
+                            const gd::String &deprecatedName = "") const;
 
   /**
    * \deprecated Use HasChild instead. This should be removed from the codebase.
@@ -376,11 +379,7 @@ class GD_CORE_API SerializerElement {
    * \param name The name of the children.
    */
   void ConsiderAsArrayOf(const gd::String &name,
-                         const gd::String &deprecatedName = "") const {
-    ConsiderAsArray();
-    arrayOf = name;
-    deprecatedArrayOf = deprecatedName;
-  };
+                         const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Return the name of the children the element is considered an array
@@ -396,7 +395,7 @@ class GD_CORE_API SerializerElement {
    *
    * \param name The name of the new child.
    */
-  SerializerElement &AddChild(gd::String name);
+  SerializerElement &AddChild(const gd::String &name);
 
   /**
    * \brief Get a child of the element using its name.
@@ -404,17 +403,17 @@ class GD_CORE_API SerializerElement {
    * \param name The name of the child.
    * \param index The index of the child, in case of an array.
    */
-  SerializerElement &GetChild(gd::String name,
+  SerializerElement &GetChild(const gd::String &name,
                               std::size_t index = 0,
-                              gd::String deprecatedName = "") const;
+                              const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Get or create a child of the element.
    *
    * \param name The name of the child.
    */
-  SerializerElement &GetOrCreateChild(gd::String name,
-                                      gd::String deprecatedName = "");
+  SerializerElement &GetOrCreateChild(const gd::String &name,
+                                      const gd::String &deprecatedName = "");
 
   /**
    * \brief Get a child of the element using its index (when the element is
@@ -435,15 +434,17 @@ class GD_CORE_API SerializerElement {
    *
    * \see SerializerElement::ConsiderAsArrayOf
    */
-  std::size_t GetChildrenCount(gd::String name = "",
-                               gd::String deprecatedName = "") const;
+  std::size_t GetChildrenCount(const gd::String &name = "",
+                               const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
+   * \note Complexity is O(1) for elements with a lot of children, O(number of
+   * children) otherwise.
    * \param name The name of the child to find.
    */
-  bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
+  bool HasChild(const gd::String &name,
+                const gd::String &deprecatedName = "") const;
 
   /**
    * \brief Remove the child with the specified name
@@ -477,6 +478,27 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement &other);
 
+  /**
+   * Return true if a child with this name is an element of the array (when
+   * the element is considered as an array).
+   */
+  bool IsArrayElementName(const gd::String &name) const {
+    return name == arrayOf || name.empty() ||
+           (!deprecatedArrayOf.empty() && name == deprecatedArrayOf);
+  }
+
+  /**
+   * Return the position of the first child with the given name, using the
+   * children index, or gd::String::npos.
+   */
+  std::size_t GetIndexedChildPosition(const gd::String &name) const;
+
+  /**
+   * Update the children index after a child was added at the end of the
+   * children, creating the index if there are enough children.
+   */
+  void IndexLastChild();
+
   bool valueUndefined = true;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
@@ -487,6 +509,13 @@ class GD_CORE_API SerializerElement {
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+  mutable bool onlyArrayElements =
+      true;  ///< true if all the children are elements of the array (see
+             ///< IsArrayElementName), so that they can be accessed directly
+             ///< by their position.
+  std::unique_ptr<std::unordered_map<gd::String, std::size_t> >
+      childrenIndex;  ///< The position of the first child for each name, only
+                      ///< created for elements with a lot of children.
 };
 
 }  // namespace gd
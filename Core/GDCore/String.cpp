@@ -9,6 +9,7 @@
 #include "GDCore/String.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <string.h>
 
 #include "GDCore/CommonTools.h"
@@ -19,6 +20,104 @@ namespace gd
 
 constexpr String::size_type String::npos;
 
+namespace priv
+{
+    /**
+     * \return the number of continuation bytes (10xxxxxx) in the 8 bytes of **word**.
+     */
+    inline std::size_t CountContinuationBytes( uint64_t word )
+    {
+        //Keep the highest bit of the bytes having their highest bit set and their
+        //second highest bit unset, then sum these bits with a multiplication.
+        uint64_t mask = word & ~(word << 1) & UINT64_C(0x8080808080808080);
+        return static_cast<std::size_t>(((mask >> 7) * UINT64_C(0x0101010101010101)) >> 56);
+    }
+
+    /**
+     * \return the number of characters in the UTF8 encoded **bytes**, i.e: the
+     * number of bytes which are not continuation bytes.
+     * \note Bytes are processed 8 by 8.
+     */
+    String::size_type CountCharacters( const char *bytes, std::size_t length )
+    {
+        String::size_type count = 0;
+        std::size_t i = 0;
+        for( ; i + 8 <= length; i += 8 )
+        {
+            uint64_t word;
+            memcpy(&word, bytes + i, 8);
+            count += 8 - CountContinuationBytes(word);
+        }
+        for( ; i < length; ++i )
+            count += (static_cast<unsigned char>(bytes[i]) & 0xC0) != 0x80;
+
+        return count;
+    }
+
+    /**
+     * \brief Move **offset** (in bytes, on the first byte of a character) forward
+     * by **count** characters in the UTF8 encoded **str**, stopping at the end of
+     * the string.
+     *
+     * **count** is decreased by the number of characters skipped, so it's not 0
+     * if the end of the string was reached before.
+     * \note Bytes are processed 8 by 8 when possible.
+     */
+    std::size_t AdvanceCharacters( const std::string &str, std::size_t offset, String::size_type &count )
+    {
+        const char *bytes = str.data();
+        const std::size_t length = str.size();
+        while( count > 0 && offset < length )
+        {
+            if( offset + 8 <= length )
+            {
+                uint64_t word;
+                memcpy(&word, bytes + offset, 8);
+                if( count >= 8 && (word & UINT64_C(0x8080808080808080)) == 0 )
+                {
+                    //8 ASCII characters.
+                    offset += 8;
+                    count -= 8;
+                    continue;
+                }
+
+                std::size_t charactersCount = 8 - CountContinuationBytes(word);
+                if( charactersCount <= count )
+                {
+                    //Skip the 8 bytes and the end of the last character started in them.
+                    offset += 8;
+                    count -= charactersCount;
+                    while( offset < length && (static_cast<unsigned char>(bytes[offset]) & 0xC0) == 0x80 )
+                        ++offset;
+                    continue;
+                }
+            }
+
+            ++offset;
+            while( offset < length && (static_cast<unsigned char>(bytes[offset]) & 0xC0) == 0x80 )
+                ++offset;
+            --count;
+        }
+
+        return offset;
+    }
+
+    /**
+     * \return the offset (in bytes) of the character at **position** in the UTF8
+     * encoded **str**, the size of **str** if **position** is the number of
+     * characters, or std::string::npos if it's greater.
+     */
+    std::size_t GetCharacterOffset( const std::string &str, String::size_type position )
+    {
+        //A character is at least 1 byte long.
+        if( position > str.size() )
+            return std::string::npos;
+
+        std::size_t offset = AdvanceCharacters(str, 0, position);
+        return position == 0 ? offset : std::string::npos;
+    }
+}
+
 String::String() : m_string()
 {
 
@@ -62,7 +161,7 @@ String& String::operator=(const std::u32string &string)
 
 String::size_type String::size() const
 {
-    return std::distance(begin(), end());
+    return priv::CountCharacters(m_string.data(), m_string.size());
 }
 
 String::iterator String::begin()
@@ -197,9 +296,11 @@ String& String::ReplaceInvalid( value_type replacement )
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
-    const_iterator it = begin();
-    std::advance(it, position);
-    return *it;
+    std::size_t offset = priv::GetCharacterOffset(m_string, position);
+    if( offset >= m_string.size() )
+        return 0;
+
+    return *const_iterator(m_string.begin() + offset);
 }
 
 String& String::operator+=( const String &other )
@@ -232,14 +333,11 @@ void String::pop_back()
 
 String& String::insert( size_type pos, const String &str )
 {
-    if(pos > size())
+    std::size_t offset = priv::GetCharacterOffset(m_string, pos);
+    if(offset == std::string::npos)
         throw std::out_of_range("[gd::String::insert] starting pos greater than size");
 
-    iterator it = begin();
-    std::advance(it, pos);
-
-    //Use the real position as bytes using the std::string::iterators
-    m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    m_string.insert( offset, str.m_string );
 
     return *this;
 }
@@ -296,38 +394,28 @@ String& String::replace( iterator i1, iterator i2, size_type n, const char c )
 
 String& String::replace( String::size_type pos, String::size_type len, const char c )
 {
-    if(pos > size())
+    std::size_t startOffset = priv::GetCharacterOffset(m_string, pos);
+    if(startOffset == std::string::npos)
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
+    //Stop at the end of the string if there are less than "len" characters.
+    std::size_t endOffset = priv::AdvanceCharacters(m_string, startOffset, len);
+    m_string.replace(startOffset, endOffset - startOffset, 1, c);
 
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
-
-    return replace( i1, i2, 1, c );
+    return *this;
 }
 
 String& String::replace( String::size_type pos, String::size_type len, const String &str )
 {
-    if(pos > size())
+    std::size_t startOffset = priv::GetCharacterOffset(m_string, pos);
+    if(startOffset == std::string::npos)
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
+    //Stop at the end of the string if there are less than "len" characters.
+    std::size_t endOffset = priv::AdvanceCharacters(m_string, startOffset, len);
+    m_string.replace(startOffset, endOffset - startOffset, str.m_string);
 
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
-
-    return replace( i1, i2, str );
+    return *this;
 }
 
 String::iterator String::erase( String::iterator first, String::iterator last )
@@ -342,20 +430,13 @@ String::iterator String::erase( String::iterator p )
 
 void String::erase( String::size_type pos, String::size_type len )
 {
-    if(pos > size())
+    std::size_t startOffset = priv::GetCharacterOffset(m_string, pos);
+    if(startOffset == std::string::npos)
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance(i1, pos);
-
-    iterator i2 = i1;
-    while(i2 != end() && len != 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        len--;
-    }
-
-    erase( i1, i2 );
+    //Stop at the end of the string if there are less than "len" characters.
+    std::size_t endOffset = priv::AdvanceCharacters(m_string, startOffset, len);
+    m_string.erase(startOffset, endOffset - startOffset);
 }
 
 std::vector<String> String::Split( String::value_type delimiter ) const
@@ -420,6 +501,26 @@ String String::UncapitalizeFirstLetter() const
 
 String String::FindAndReplace(String search, String replacement, bool all) const
 {
+    if(!search.empty())
+    {
+        //As UTF8 is self-synchronizing, an occurence of a valid UTF8 string
+        //always starts on a character: the search can be done on the bytes
+        //and the result built in a single pass.
+        gd::String result;
+        std::string::size_type pos, lastPos = 0;
+        while((pos = m_string.find(search.m_string, lastPos)) != std::string::npos)
+        {
+            result.m_string.append(m_string, lastPos, pos - lastPos);
+            result.m_string.append(replacement.m_string);
+            lastPos = pos + search.m_string.size();
+            if(!all) break;
+        }
+        if(lastPos == 0) return *this;
+
+        result.m_string.append(m_string, lastPos, std::string::npos);
+        return result;
+    }
+
     gd::String result(*this);
 
     size_type pos, lastPos = 0;
@@ -461,50 +562,31 @@ String String::substr( String::size_type start, String::size_type length ) const
 {
     String str;
 
-    const_iterator startIt = begin();
-    while(start > 0 && startIt != end())
-    {
-        ++startIt;
-        --start;
-    }
-    if(start > 0) //We reach the end of the string before the start position
+    std::size_t startOffset = priv::GetCharacterOffset(m_string, start);
+    if(startOffset == std::string::npos) //We reach the end of the string before the start position
         throw std::out_of_range("[gd::String::substr] starting pos greater than size");
 
-    const_iterator endIt = startIt;
-    while(length > 0 && endIt != end())
-    {
-        ++endIt;
-        --length;
-    }
-
-    str.m_string = std::string( startIt.base(), endIt.base() );
+    std::size_t endOffset = priv::AdvanceCharacters(m_string, startOffset, length);
+    str.m_string = m_string.substr( startOffset, endOffset - startOffset );
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
-    const_iterator it = begin();
-
-    //Move to pos
-    if(pos < size())
-        std::advance( it, pos );
-    else
+    //Move to pos, which must be a character of the string.
+    std::size_t offset = priv::GetCharacterOffset(m_string, pos);
+    if(offset == std::string::npos || offset == m_string.size())
         return npos;
 
-    //Use the standard std::string to find a string (using their internal std::strings).
-    //Use the raw std::string iterator to get the offset as a **byte** count for the starting
-    //position.
-    std::string::size_type findPos =
-        m_string.find( search.m_string, std::distance( m_string.begin(), it.base() ) );
+    //Use the standard std::string to find a string (using their internal std::strings),
+    //starting from the offset as a **byte** count.
+    std::string::size_type findPos = m_string.find( search.m_string, offset );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator from the std::string::iterator pointing to the find result.
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance in **characters** count (that's why we need a String::iterator).
-        return std::distance( begin(), findPosIt );
+        //Return the position in **characters** count.
+        return pos + priv::CountCharacters( m_string.data() + offset, findPos - offset );
     }
     else
         return npos;
@@ -522,32 +604,22 @@ String::size_type String::find( const String::value_type search, String::size_ty
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
-    //Move to pos + 1 (we will then get the last byte of the character at pos)
-    const_iterator it = begin();
-    std::string::const_iterator baseIt;
-    if( pos < size() ) //little optimization by testing npos directly (avoid calculating size())
+    //The last character is included, so we need to put the position
+    //of the last byte of the character at the position "pos"
+    std::string::size_type lastByte = std::string::npos;
+    std::size_t offset = priv::GetCharacterOffset(m_string, pos);
+    if( offset != std::string::npos && offset < m_string.size() )
     {
-        std::advance( it, pos + 1 );
-        baseIt = it.base();
-        --baseIt; //Decrement the std::string::iterator by one because we need
-        //it to point to the last byte of the character at pos
+        String::size_type oneCharacter = 1;
+        lastByte = priv::AdvanceCharacters(m_string, offset, oneCharacter) - 1;
     }
 
-    //The last character is included, so we need to put the position
-    //of the last byte of the character at the position "pos"
-    std::string::size_type findPos = m_string.rfind( search.m_string,
-        pos < size() ? std::distance( m_string.begin(), baseIt ) : std::string::npos
-        );
+    std::string::size_type findPos = m_string.rfind( search.m_string, lastByte );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator to the find position to be able to get the real
-        //distance as characters count (it would be a distance as bytes count
-        //with a std::string::iterator)
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance (which is a distance as characters count)
-        return std::distance( begin(), findPosIt );
+        //Return the position as characters count (not as bytes count)
+        return priv::CountCharacters( m_string.data(), findPos );
     }
     else
         return npos;
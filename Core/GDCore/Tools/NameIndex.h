@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A hash index from names to the items of a container, used to find
+ * items by name without scanning the container.
+ *
+ * The container keeps its items in a vector (so that their order is kept
+ * for serialization) and tells the index about insertions and removals. As
+ * items can be renamed without the container being notified, the index is
+ * also given a "names revision" changing every time an item of this kind is
+ * renamed: if it changed, or if the number of items is not the expected one,
+ * the index is rebuilt the next time it's used.
+ *
+ * If several items have the same name, the first one (by position) is found,
+ * like when scanning the container.
+ *
+ * Lookups are safe to do from several threads (as long as the container is
+ * not modified at the same time).
+ *
+ * \note Copying an index gives an empty index, built on its first use.
+ */
+template <class T>
+class NameIndex {
+ public:
+  NameIndex(){};
+  NameIndex(const NameIndex<T>&){};
+  NameIndex<T>& operator=(const NameIndex<T>&) {
+    Invalidate();
+    return *this;
+  };
+  virtual ~NameIndex(){};
+
+  /**
+   * \brief Return the first item named \a name in \a items (a vector of
+   * pointers), or nullptr if there is none.
+   */
+  template <class Items>
+  T* Find(const gd::String& name,
+          const Items& items,
+          std::size_t namesRevision) const {
+    if (!IsUpToDate(items.size(), namesRevision)) {
+      std::lock_guard<std::mutex> lock(rebuildMutex);
+      if (!IsUpToDate(items.size(), namesRevision))
+        Rebuild(items, namesRevision);
+    }
+
+    auto it = index.find(name);
+    return it != index.end() ? it->second : nullptr;
+  };
+
+  /**
+   * \brief To be called after \a item was inserted in \a items.
+   */
+  template <class Items>
+  void OnItemInserted(T& item, const Items& items, std::size_t namesRevision) {
+    if (hasDuplicateNames ||
+        !IsUpToDate(items.size() - 1, namesRevision) ||
+        !index.emplace(item.GetName(), &item).second) {
+      // The position of the item would be needed to know if it's now the
+      // first one with this name.
+      Invalidate();
+      return;
+    }
+    indexedItemsCount = items.size();
+  };
+
+  /**
+   * \brief To be called after the item named \a name was removed from
+   * \a items.
+   */
+  template <class Items>
+  void OnItemRemoved(const gd::String& name,
+                     const Items& items,
+                     std::size_t namesRevision) {
+    if (hasDuplicateNames || !IsUpToDate(items.size() + 1, namesRevision)) {
+      Invalidate();
+      return;
+    }
+    index.erase(name);
+    indexedItemsCount = items.size();
+  };
+
+  /**
+   * \brief To be called after items were moved in the container.
+   */
+  void OnItemsMoved() {
+    if (hasDuplicateNames) Invalidate();
+  };
+
+  /**
+   * \brief Mark the index as outdated, so that it's rebuilt on its next use.
+   */
+  void Invalidate() { indexedNamesRevision = gd::String::npos; };
+
+ private:
+  bool IsUpToDate(std::size_t itemsCount, std::size_t namesRevision) const {
+    return indexedNamesRevision == namesRevision &&
+           indexedItemsCount == itemsCount;
+  };
+
+  template <class Items>
+  void Rebuild(const Items& items, std::size_t namesRevision) const {
+    index.clear();
+    index.reserve(items.size());
+    hasDuplicateNames = false;
+    for (const auto& item : items) {
+      if (!item) continue;
+      if (!index.emplace(item->GetName(), &*item).second)
+        hasDuplicateNames = true;
+    }
+    indexedItemsCount = items.size();
+    indexedNamesRevision = namesRevision;
+  };
+
+  mutable std::unordered_map<gd::String, T*> index;
+  mutable bool hasDuplicateNames = false;
+  mutable std::atomic<std::size_t> indexedItemsCount{0};
+  mutable std::atomic<std::size_t> indexedNamesRevision{gd::String::npos};
+  mutable std::mutex rebuildMutex;
+};
+
+}  // namespace gd
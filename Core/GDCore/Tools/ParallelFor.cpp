@@ -0,0 +1,67 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ParallelFor.h"
+
+#if !defined(EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#define GD_PARALLEL_FOR_USE_THREADS
+#endif
+
+#if defined(GD_PARALLEL_FOR_USE_THREADS)
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+namespace gd {
+
+bool IsParallelForSupported() {
+#if defined(GD_PARALLEL_FOR_USE_THREADS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void ParallelFor(std::size_t count,
+                 std::size_t threadsCount,
+                 const std::function<void(std::size_t)>& task) {
+#if defined(GD_PARALLEL_FOR_USE_THREADS)
+  if (threadsCount > count) threadsCount = count;
+  if (threadsCount > 1) {
+    std::atomic<std::size_t> nextIndex(0);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto runTasks = [&]() {
+      for (std::size_t i = nextIndex++; i < count; i = nextIndex++) {
+        try {
+          task(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(exceptionMutex);
+          if (!firstException) firstException = std::current_exception();
+        }
+      }
+    };
+
+    // The calling thread also runs tasks.
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount - 1);
+    for (std::size_t i = 0; i + 1 < threadsCount; ++i)
+      threads.emplace_back(runTasks);
+    runTasks();
+    for (auto& thread : threads) thread.join();
+
+    if (firstException) std::rethrow_exception(firstException);
+    return;
+  }
+#endif
+
+  for (std::size_t i = 0; i < count; ++i) task(i);
+}
+
+}  // namespace gd
@@ -0,0 +1,35 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace gd {
+
+/**
+ * \brief Return true if ParallelFor can run tasks on several threads (native
+ * builds, or WebAssembly builds compiled with pthreads support).
+ */
+bool GD_CORE_API IsParallelForSupported();
+
+/**
+ * \brief Call \a task for each index in [0, \a count), using up to
+ * \a threadsCount threads.
+ *
+ * Indexes are distributed to the threads as they become available, so tasks
+ * must not depend on each other. The function returns when all the tasks are
+ * done. If a task throws, the first exception is rethrown after all threads
+ * are finished.
+ *
+ * Tasks are run on the calling thread when \a threadsCount is 0 or 1, when
+ * there is only one task or when threads are not supported.
+ */
+void GD_CORE_API ParallelFor(std::size_t count,
+                             std::size_t threadsCount,
+                             const std::function<void(std::size_t)>& task);
+
+}  // namespace gd
@@ -0,0 +1,231 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/BinarySerializer.h"
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "GDCore/CommonTools.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+
+void FillTestElement(SerializerElement& element) {
+  element.SetAttribute("name", "MyProject");
+  element.SetAttribute("version", 3);
+  element.SetAttribute("negative", -1234567);
+  element.SetAttribute("ratio", 0.25);
+  element.SetAttribute("enabled", true);
+  element.AddChild("description").SetStringValue("Un jeu très bien");
+  element.AddChild("emptyString").SetStringValue("");
+  element.AddChild("emptyElement");
+
+  SerializerElement& objects = element.AddChild("objects");
+  objects.ConsiderAsArrayOf("object");
+  for (std::size_t i = 0; i < 3; ++i) {
+    SerializerElement& object = objects.AddChild("object");
+    object.SetAttribute("name", "Object" + gd::String::From(i));
+    object.SetAttribute("type", "Sprite");
+    object.AddChild("x").SetDoubleValue(i * 1.5);
+    object.AddChild("zOrder").SetIntValue(-static_cast<int>(i));
+  }
+
+  SerializerElement& array = element.AddChild("array");
+  array.ConsiderAsArray();
+  array.AddChild("").SetBoolValue(false);
+  array.AddChild("").SetStringValue("Sprite");
+}
+
+}  // namespace
+
+TEST_CASE("BinarySerializer", "[common]") {
+  SECTION("Round trip") {
+    SerializerElement element;
+    FillTestElement(element);
+
+    for (bool withChecksum : {false, true}) {
+      std::vector<uint8_t> buffer;
+      BinarySerializer::SerializeToBinaryBuffer(element, buffer, withChecksum);
+
+      SerializerElement deserializedElement;
+      REQUIRE(BinarySerializer::DeserializeFromBinaryBuffer(
+          buffer.data(), buffer.size(), deserializedElement));
+      REQUIRE(Serializer::ToJSON(deserializedElement) ==
+              Serializer::ToJSON(element));
+      REQUIRE(deserializedElement.GetChild("objects")
+                  .GetChild("object", 2)
+                  .GetChild("zOrder")
+                  .GetValue()
+                  .IsInt());
+      REQUIRE(deserializedElement.GetChild("objects")
+                  .GetChild("object", 2)
+                  .GetChild("zOrder")
+                  .GetIntValue() == -2);
+    }
+  }
+
+  SECTION("Strings are only stored once") {
+    SerializerElement element;
+    element.ConsiderAsArrayOf("child");
+    for (std::size_t i = 0; i < 100; ++i) {
+      element.AddChild("child").SetStringValue(
+          "A quite long string, repeated a lot of times");
+    }
+
+    std::vector<uint8_t> buffer;
+    BinarySerializer::SerializeToBinaryBuffer(element, buffer);
+    REQUIRE(buffer.size() < 1000);
+  }
+
+  SECTION("Buffers written with the first version can be read") {
+    // Magic, version 1 and then: an element with an undefined value, an
+    // attribute "a" (int 42), not an array, no "arrayOf", one child "b"
+    // with a string value "c", no attributes and no children.
+    std::vector<uint8_t> buffer;
+    auto write = [&buffer](const void* data, std::size_t size) {
+      const uint8_t* bytes = static_cast<const uint8_t*>(data);
+      buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+    auto writeUint32 = [&write](uint32_t value) {
+      write(&value, sizeof(value));
+    };
+    auto writeString = [&write, &writeUint32](const std::string& str) {
+      writeUint32(static_cast<uint32_t>(str.size()));
+      write(str.data(), str.size());
+    };
+    auto writeByte = [&buffer](uint8_t value) { buffer.push_back(value); };
+
+    writeUint32(0x47444253);
+    writeUint32(1);
+    writeByte(0x01);  // Element
+    writeByte(0x02);  // Undefined value
+    writeUint32(1);
+    writeString("a");
+    writeByte(0x04);  // Int
+    int value = 42;
+    write(&value, sizeof(value));
+    writeByte(0);
+    writeString("");
+    writeUint32(1);
+    writeString("b");
+    writeByte(0x01);  // Element
+    writeByte(0x06);  // String
+    writeString("c");
+    writeUint32(0);
+    writeByte(0);
+    writeString("");
+    writeUint32(0);
+
+    SerializerElement element;
+    REQUIRE(BinarySerializer::DeserializeFromBinaryBuffer(
+        buffer.data(), buffer.size(), element));
+    REQUIRE(element.GetIntAttribute("a") == 42);
+    REQUIRE(element.GetChild("b").GetStringValue() == "c");
+  }
+
+  SECTION("Invalid buffers") {
+    SerializerElement element;
+    FillTestElement(element);
+
+    std::vector<uint8_t> buffer;
+    BinarySerializer::SerializeToBinaryBuffer(element, buffer, true);
+
+    SerializerElement deserializedElement;
+    std::vector<uint8_t> corruptedBuffer = buffer;
+    corruptedBuffer[corruptedBuffer.size() / 2] ^= 0x10;
+    REQUIRE_FALSE(BinarySerializer::DeserializeFromBinaryBuffer(
+        corruptedBuffer.data(), corruptedBuffer.size(), deserializedElement));
+
+    std::vector<uint8_t> truncatedBuffer(buffer.begin(), buffer.end() - 10);
+    REQUIRE_FALSE(BinarySerializer::DeserializeFromBinaryBuffer(
+        truncatedBuffer.data(), truncatedBuffer.size(), deserializedElement));
+
+    std::vector<uint8_t> unknownVersionBuffer = buffer;
+    unknownVersionBuffer[4] = 99;
+    REQUIRE_FALSE(BinarySerializer::DeserializeFromBinaryBuffer(
+        unknownVersionBuffer.data(), unknownVersionBuffer.size(),
+        deserializedElement));
+
+    // Without a checksum, truncated or extended buffers are still detected.
+    std::vector<uint8_t> bufferWithoutChecksum;
+    BinarySerializer::SerializeToBinaryBuffer(element, bufferWithoutChecksum);
+    std::vector<uint8_t> extendedBuffer = bufferWithoutChecksum;
+    extendedBuffer.push_back(0);
+    REQUIRE_FALSE(BinarySerializer::DeserializeFromBinaryBuffer(
+        extendedBuffer.data(), extendedBuffer.size(), deserializedElement));
+    REQUIRE_FALSE(BinarySerializer::DeserializeFromBinaryBuffer(
+        bufferWithoutChecksum.data(), bufferWithoutChecksum.size() - 1,
+        deserializedElement));
+  }
+
+  SECTION("Benchmark") {
+    // A project-like element of a few MB.
+    SerializerElement projectElement;
+    SerializerElement& layoutsElement = projectElement.AddChild("layouts");
+    layoutsElement.ConsiderAsArrayOf("layout");
+    for (std::size_t i = 0; i < 200; ++i) {
+      SerializerElement& layoutElement = layoutsElement.AddChild("layout");
+      layoutElement.SetAttribute("name", "Layout" + gd::String::From(i));
+      SerializerElement& instancesElement =
+          layoutElement.AddChild("instances");
+      instancesElement.ConsiderAsArrayOf("instance");
+      for (std::size_t j = 0; j < 100; ++j) {
+        SerializerElement& instanceElement =
+            instancesElement.AddChild("instance");
+        instanceElement.SetAttribute("name", "Object" + gd::String::From(j));
+        instanceElement.SetAttribute("x", j * 1.5);
+        instanceElement.SetAttribute("y", j * 2.0);
+        instanceElement.SetAttribute("zOrder", (int)j);
+        instanceElement.SetAttribute("locked", false);
+        instanceElement.SetAttribute("layer", "");
+        instanceElement.SetAttribute("persistentUuid",
+                                     "uuid-" + gd::String::From(i) + "-" +
+                                         gd::String::From(j));
+      }
+    }
+
+    auto measure = [](const std::function<void()>& function) {
+      auto start = std::chrono::steady_clock::now();
+      function();
+      return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - start)
+          .count();
+    };
+
+    // Compare with the element as it is when loaded from a project file.
+    gd::String json = Serializer::ToJSON(projectElement);
+    std::unique_ptr<SerializerElement> jsonElement;
+    auto fromJSONTime = measure([&]() {
+      jsonElement.reset(new SerializerElement(Serializer::FromJSON(json)));
+    });
+
+    std::vector<uint8_t> buffer;
+    auto toBinaryTime = measure([&]() {
+      BinarySerializer::SerializeToBinaryBuffer(*jsonElement, buffer, true);
+    });
+    SerializerElement binaryElement;
+    auto fromBinaryTime = measure([&]() {
+      REQUIRE(BinarySerializer::DeserializeFromBinaryBuffer(
+          buffer.data(), buffer.size(), binaryElement));
+    });
+
+    REQUIRE(Serializer::ToJSON(binaryElement) == json);
+    REQUIRE(buffer.size() < json.size());
+
+    std::cout << "Binary buffer of " << buffer.size() << " bytes (JSON: "
+              << json.size() << " bytes) written in " << toBinaryTime
+              << "ms. Read in " << fromBinaryTime << "ms (JSON: "
+              << fromJSONTime << "ms)." << std::endl;
+  }
+}
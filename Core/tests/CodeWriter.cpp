@@ -0,0 +1,74 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/CodeWriter.h"
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("CodeWriter", "[common][events]") {
+  SECTION("Empty writer") {
+    gd::CodeWriter writer;
+    REQUIRE(writer.IsEmpty());
+    REQUIRE(writer.GetSize() == 0);
+    REQUIRE(writer.ToString() == "");
+
+    writer << "" << gd::String();
+    REQUIRE(writer.IsEmpty());
+  }
+
+  SECTION("Small pieces of code") {
+    gd::CodeWriter writer;
+    gd::String functionName = "gdjs.MySceneCode.func";
+    writer << functionName << " = function(" << gd::String("runtimeScene")
+           << ") {\n"
+           << "}\n";
+
+    REQUIRE(writer.GetSize() == 51);
+    REQUIRE(writer.ToString() ==
+            "gdjs.MySceneCode.func = function(runtimeScene) {\n}\n");
+
+    gd::String output = "// Prefix\n";
+    writer.AppendTo(output);
+    REQUIRE(output ==
+            "// Prefix\ngdjs.MySceneCode.func = function(runtimeScene) {\n}\n");
+
+    writer.Clear();
+    REQUIRE(writer.IsEmpty());
+    REQUIRE(writer.ToString() == "");
+  }
+
+  SECTION("Large pieces of code") {
+    gd::String largeCode;
+    gd::String expectedCode;
+    for (std::size_t i = 0; i < 5000; ++i) {
+      largeCode += "console.log(" + gd::String::From(i) + ");\n";
+    }
+
+    gd::CodeWriter writer;
+    for (std::size_t i = 0; i < 3; ++i) {
+      gd::String codeCopy = largeCode;
+      writer << "{\n" << std::move(codeCopy) << "}\n" << largeCode;
+      expectedCode += "{\n" + largeCode + "}\n" + largeCode;
+    }
+    writer << "// The end\n";
+    expectedCode += "// The end\n";
+
+    REQUIRE(writer.GetSize() == expectedCode.Raw().size());
+    REQUIRE(writer.ToString() == expectedCode);
+
+    gd::CodeWriter otherWriter;
+    otherWriter << "// Start\n" << writer << "// End\n";
+    REQUIRE(otherWriter.ToString() ==
+            "// Start\n" + expectedCode + "// End\n");
+  }
+
+  SECTION("Non ASCII code") {
+    gd::CodeWriter writer;
+    writer << "\"Un événement\"" << gd::String(" + \"日本語\"");
+    REQUIRE(writer.ToString() == "\"Un événement\" + \"日本語\"");
+    REQUIRE(writer.GetSize() == writer.ToString().Raw().size());
+  }
+}
@@ -8,6 +8,7 @@
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include <memory>
+#include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
@@ -265,4 +266,52 @@ TEST_CASE("EventsCodeGenerationContext", "[common][events]") {
     REQUIRE(c5.ShouldUseAsyncObjectsList("c5.empty1") == false);
 
   }
+
+  SECTION("Objects lists are not shared after a modification") {
+    // c1 declares more objects lists after c2 was created: c2 must not see
+    // them, but a new child of c1 must.
+    c1.ObjectsListNeeded("c1.object3");
+    REQUIRE(c2.ObjectAlreadyDeclaredByParents("c1.object3") == false);
+
+    gd::EventsCodeGenerationContext c6;
+    c6.InheritsFrom(c1);
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("c1.object3") == true);
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("c1.object1") == true);
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("c2.object1") == false);
+
+    // A child using an objects list does not change the depth of the last use
+    // seen by its parent or its siblings.
+    c4.ObjectsListNeeded("c1.object1");
+    REQUIRE(c4.GetLastDepthObjectListWasNeeded("c1.object1") == 2);
+    REQUIRE(c2.GetLastDepthObjectListWasNeeded("c1.object1") == 0);
+    REQUIRE(c5.GetLastDepthObjectListWasNeeded("c1.object1") == 0);
+    REQUIRE(c1.GetLastDepthObjectListWasNeeded("c1.object1") == 0);
+
+    // Unknown objects lists.
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("unknown") == false);
+    gd::EventsCodeGenerationContext c7;
+    REQUIRE(c7.ObjectAlreadyDeclaredByParents("c1.object1") == false);
+    REQUIRE(c7.GetObjectsListsAlreadyDeclaredByParents() ==
+            std::set<gd::String>());
+  }
+
+  SECTION("Deeply nested contexts") {
+    std::vector<std::unique_ptr<gd::EventsCodeGenerationContext>> contexts;
+    contexts.emplace_back(new gd::EventsCodeGenerationContext(&maxDepth));
+    for (std::size_t i = 1; i < 100; ++i) {
+      contexts.emplace_back(new gd::EventsCodeGenerationContext);
+      contexts[i]->InheritsFrom(*contexts[i - 1]);
+      if (i % 10 == 0)
+        contexts[i]->ObjectsListNeeded("Object" + gd::String::From(i));
+    }
+
+    REQUIRE(maxDepth == 99);
+    const auto& lastContext = *contexts.back();
+    REQUIRE(lastContext.GetObjectsListsAlreadyDeclaredByParents().size() == 9);
+    REQUIRE(lastContext.ObjectAlreadyDeclaredByParents("Object90") == true);
+    REQUIRE(lastContext.GetLastDepthObjectListWasNeeded("Object90") == 90);
+    REQUIRE(contexts[50]->ObjectAlreadyDeclaredByParents("Object40") == true);
+    REQUIRE(contexts[50]->ObjectAlreadyDeclaredByParents("Object50") == false);
+    REQUIRE(contexts[50]->ObjectAlreadyDeclaredByParents("Object60") == false);
+  }
 }
@@ -0,0 +1,186 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+
+#include <chrono>
+#include <memory>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+std::shared_ptr<gd::PlatformExtension> MakeExtensionWithAction(
+    const gd::String &extensionName, const gd::String &actionName) {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(
+      extensionName, extensionName, "Extension for tests", "", "MIT");
+  extension->AddAction(actionName,
+                       "Test action",
+                       "Test action",
+                       "Test action",
+                       "",
+                       "",
+                       "");
+  return extension;
+}
+
+// The lookup that was done before the metadata index was introduced: a scan
+// of all the extensions, their objects and their behaviors.
+const gd::InstructionMetadata *FindActionWithLinearScan(
+    const gd::Platform &platform, const gd::String &actionType) {
+  for (auto &extension : platform.GetAllPlatformExtensions()) {
+    const auto &allActions = extension->GetAllActions();
+    if (allActions.find(actionType) != allActions.end())
+      return &allActions.find(actionType)->second;
+
+    for (const gd::String &objectType :
+         extension->GetExtensionObjectsTypes()) {
+      const auto &allObjectsActions =
+          extension->GetAllActionsForObject(objectType);
+      if (allObjectsActions.find(actionType) != allObjectsActions.end())
+        return &allObjectsActions.find(actionType)->second;
+    }
+
+    for (const gd::String &behaviorType : extension->GetBehaviorsTypes()) {
+      const auto &allBehaviorsActions =
+          extension->GetAllActionsForBehavior(behaviorType);
+      if (allBehaviorsActions.find(actionType) != allBehaviorsActions.end())
+        return &allBehaviorsActions.find(actionType)->second;
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_CASE("MetadataProvider", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Finds metadata of every kind") {
+    REQUIRE(gd::MetadataProvider::GetExtensionAndObjectMetadata(
+                platform, "MyExtension::Sprite")
+                .GetExtension()
+                .GetName() == "MyExtension");
+    REQUIRE(!gd::MetadataProvider::IsBadBehaviorMetadata(
+        gd::MetadataProvider::GetBehaviorMetadata(
+            platform, "MyExtension::MyBehavior")));
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyExtension::DoSomething")));
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, "SetNumberObjectVariable")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetObjectNumber")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectStrExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetObjectStringWith1Param")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetStrExpressionMetadata(
+            platform, "MyExtension::ToString")));
+
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyExtension::Unknown")));
+    REQUIRE(gd::MetadataProvider::IsBadObjectMetadata(
+        gd::MetadataProvider::GetObjectMetadata(platform,
+                                                "MyExtension::Unknown")));
+  }
+
+  SECTION("Falls back to the base object expressions") {
+    const auto &baseObjectExpression =
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "", "GetFromBaseExpression");
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        baseObjectExpression));
+    REQUIRE(&gd::MetadataProvider::GetObjectExpressionMetadata(
+                platform, "MyExtension::Sprite", "GetFromBaseExpression") ==
+            &baseObjectExpression);
+  }
+
+  SECTION("Index is updated when extensions are added or removed") {
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "NewExtension::NewAction")));
+
+    platform.AddExtension(MakeExtensionWithAction("NewExtension", "NewAction"));
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(
+                platform, "NewExtension::NewAction")
+                .GetExtension()
+                .GetName() == "NewExtension");
+
+    platform.RemoveExtension("NewExtension");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "NewExtension::NewAction")));
+  }
+
+  SECTION("First extension declaring a type has the priority") {
+    // Some builtin extensions have no namespace: both declare the same action.
+    platform.AddExtension(MakeExtensionWithAction("BuiltinTime", "Action"));
+    platform.AddExtension(MakeExtensionWithAction("BuiltinFile", "Action"));
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(platform,
+                                                                "Action")
+                .GetExtension()
+                .GetName() == "BuiltinTime");
+  }
+}
+
+TEST_CASE("MetadataProvider - Benchmarks", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  const std::size_t extensionsCount = 200;
+  for (std::size_t i = 0; i < extensionsCount; ++i) {
+    gd::String extensionName = "Extension" + gd::String::From(i);
+    platform.AddExtension(
+        MakeExtensionWithAction(extensionName, "Action"));
+  }
+  std::vector<gd::String> actionTypes = {
+      "MyExtension::DoSomething",
+      "SetNumberObjectVariable",
+      "Extension0::Action",
+      "Extension199::Action",
+      "UnknownAction",
+  };
+  const std::size_t runsCount = 2000;
+
+  auto doBenchmark = [&](const gd::String &benchmarkName,
+                         std::function<bool(const gd::String &)> func) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < runsCount; ++i) {
+      for (const gd::String &actionType : actionTypes) {
+        REQUIRE(func(actionType) == (actionType != "UnknownAction"));
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << benchmarkName << " benchmark ("
+              << runsCount * actionTypes.size() << " lookups, "
+              << extensionsCount << "+ extensions): "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end -
+                                                                       start)
+                     .count()
+              << " microseconds" << std::endl;
+  };
+
+  doBenchmark("MetadataProvider linear scan", [&](const gd::String &type) {
+    return FindActionWithLinearScan(platform, type) != nullptr;
+  });
+  doBenchmark("MetadataProvider indexed lookup", [&](const gd::String &type) {
+    return !gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform, type));
+  });
+}
@@ -0,0 +1,143 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/ObjectsContainer.h"
+
+#include <chrono>
+#include <iostream>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsContainer", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Find objects by name after insertions and removals") {
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+    container.InsertNewObject(project, "MyExtension::Sprite", "MyObject1", 0);
+    container.InsertNewObject(project, "MyExtension::Sprite", "MyObject2", 1);
+    std::unique_ptr<gd::Object> object =
+        project.CreateObject("MyExtension::Sprite", "MyObject3");
+    container.InsertObject(*object, 0);
+
+    REQUIRE(container.HasObjectNamed("MyObject1"));
+    REQUIRE(container.HasObjectNamed("MyObject2"));
+    REQUIRE(container.HasObjectNamed("MyObject3"));
+    REQUIRE(!container.HasObjectNamed("MyObject4"));
+    REQUIRE(container.GetObjectPosition("MyObject3") == 0);
+    REQUIRE(container.GetObjectPosition("MyObject2") == 2);
+    REQUIRE(container.GetObjectPosition("MyObject4") == gd::String::npos);
+
+    container.RemoveObject("MyObject1");
+    REQUIRE(!container.HasObjectNamed("MyObject1"));
+    REQUIRE(container.GetObjectPosition("MyObject2") == 1);
+    REQUIRE(container.GetObject("MyObject2").GetName() == "MyObject2");
+
+    container.MoveObject(1, 0);
+    REQUIRE(container.GetObjectPosition("MyObject2") == 0);
+    REQUIRE(container.GetObjectPosition("MyObject3") == 1);
+
+    container.Clear();
+    REQUIRE(!container.HasObjectNamed("MyObject2"));
+    REQUIRE(container.GetObjectsCount() == 0);
+  }
+
+  SECTION("Find objects renamed without the container") {
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+    gd::Object &object = container.InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    REQUIRE(container.HasObjectNamed("MyObject"));
+
+    object.SetName("MyRenamedObject");
+    REQUIRE(!container.HasObjectNamed("MyObject"));
+    REQUIRE(container.HasObjectNamed("MyRenamedObject"));
+    REQUIRE(&container.GetObject("MyRenamedObject") == &object);
+
+    gd::SerializerElement element;
+    element.SetAttribute("name", "MyUnserializedObject");
+    element.SetAttribute("type", "MyExtension::Sprite");
+    object.UnserializeFrom(project, element);
+    REQUIRE(!container.HasObjectNamed("MyRenamedObject"));
+    REQUIRE(container.HasObjectNamed("MyUnserializedObject"));
+  }
+
+  SECTION("Find the first object when names are duplicated") {
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+    gd::Object &object1 = container.InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    gd::Object &object2 = container.InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    REQUIRE(&container.GetObject("MyObject") == &object2);
+
+    container.MoveObject(0, 1);
+    REQUIRE(&container.GetObject("MyObject") == &object1);
+
+    container.RemoveObject("MyObject");
+    REQUIRE(container.GetObjectsCount() == 1);
+    REQUIRE(&container.GetObject("MyObject") == &object2);
+  }
+
+  SECTION("Copies find their own objects") {
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+    container.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    REQUIRE(container.HasObjectNamed("MyObject"));
+
+    gd::ObjectsContainer copy = container;
+    REQUIRE(copy.HasObjectNamed("MyObject"));
+    REQUIRE(&copy.GetObject("MyObject") != &container.GetObject("MyObject"));
+  }
+
+  SECTION("Move objects to another container") {
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+    gd::ObjectsContainer otherContainer(
+        gd::ObjectsContainer::SourceType::Global);
+    container.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    REQUIRE(!otherContainer.HasObjectNamed("MyObject"));
+
+    auto &objectFolderOrObject =
+        container.GetRootFolder().GetObjectNamed("MyObject");
+    container.MoveObjectFolderOrObjectToAnotherContainerInFolder(
+        objectFolderOrObject, otherContainer, otherContainer.GetRootFolder(),
+        0);
+    REQUIRE(!container.HasObjectNamed("MyObject"));
+    REQUIRE(otherContainer.HasObjectNamed("MyObject"));
+  }
+
+  SECTION("Benchmark") {
+    gd::ObjectsContainer container(gd::ObjectsContainer::SourceType::Scene);
+    const std::size_t objectsCount = 5000;
+    for (std::size_t i = 0; i < objectsCount; ++i) {
+      container.InsertNewObject(project,
+                                "MyExtension::Sprite",
+                                "MyObject" + gd::String::From(i),
+                                container.GetObjectsCount());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t foundCount = 0;
+    for (std::size_t i = 0; i < objectsCount; ++i) {
+      if (container.HasObjectNamed("MyObject" + gd::String::From(i)))
+        foundCount++;
+      if (container.HasObjectNamed("MyMissingObject" + gd::String::From(i)))
+        foundCount++;
+    }
+    auto end = std::chrono::steady_clock::now();
+    REQUIRE(foundCount == objectsCount);
+
+    std::cout << "ObjectsContainer::HasObjectNamed benchmark ("
+              << objectsCount * 2 << " lookups in " << objectsCount
+              << " objects): "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end -
+                                                                       start)
+                     .count()
+              << " microseconds" << std::endl;
+  }
+}
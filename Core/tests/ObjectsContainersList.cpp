@@ -825,3 +825,87 @@ TEST_CASE("ObjectContainersList (GetAnimationNamesOfObject)", "[common]") {
     REQUIRE(animationNames.size() == 2);
   }
 }
+
+TEST_CASE("ObjectContainersList (groups modifications)", "[common]") {
+
+  SECTION("Groups are resolved again after objects or groups are modified") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    gd::Object &object1 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject1", 0);
+    object1.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    object1.GetVariables().InsertNew("MyVariable", 0).SetValue(1);
+    gd::Object &object2 = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject2", 0);
+    object2.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+
+    auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    group.AddObject(object1.GetName());
+    group.AddObject(object2.GetName());
+
+    auto objectsContainersList = gd::ObjectsContainersList::
+        MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup", true)
+                .size() == 1);
+    REQUIRE(objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                             "MyBehavior"));
+    REQUIRE(objectsContainersList.GetTypeOfBehaviorInObjectOrGroup(
+                "MyGroup", "MyBehavior", true) == "MyExtension::MyBehavior");
+    REQUIRE(objectsContainersList.HasObjectOrGroupWithVariableNamed(
+                "MyGroup", "MyVariable") ==
+            gd::ObjectsContainersList::ExistsOnlyOnSomeObjectsOfTheGroup);
+    REQUIRE(objectsContainersList.GetObjectOrGroupVariablesContainer(
+                "MyGroup") == &object1.GetVariables());
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 2);
+
+    // Behaviors modifications.
+    object2.RemoveBehavior("MyBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup", true)
+                .size() == 0);
+    REQUIRE(!objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                              "MyBehavior"));
+    REQUIRE(objectsContainersList.GetTypeOfBehaviorInObjectOrGroup(
+                "MyGroup", "MyBehavior", true) == "");
+
+    // Objects modifications.
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::FakeObjectWithDefaultBehavior", "MyObject3", 0);
+    group.AddObject("MyObject3");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 3);
+
+    layout.GetObjects().RemoveObject("MyObject3");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 2);
+    group.RemoveObject("MyObject3");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+
+    object2.GetVariables().InsertNew("MyVariable", 0).SetValue(2);
+    REQUIRE(objectsContainersList.HasObjectOrGroupWithVariableNamed(
+                "MyGroup", "MyVariable") ==
+            gd::ObjectsContainersList::Exists);
+
+    // Groups modifications.
+    group.RemoveObject("MyObject1");
+    REQUIRE(objectsContainersList.GetObjectOrGroupVariablesContainer(
+                "MyGroup") == &object2.GetVariables());
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 1);
+
+    object2.SetName("MyRenamedObject2");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyGroup").size() == 0);
+    REQUIRE(objectsContainersList.GetObjectOrGroupVariablesContainer(
+                "MyGroup") == nullptr);
+
+    layout.GetObjects().GetObjectGroups().Rename("MyGroup", "MyRenamedGroup");
+    REQUIRE(!objectsContainersList.HasObjectOrGroupNamed("MyGroup"));
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+    REQUIRE(objectsContainersList.ExpandObjectName("MyRenamedGroup").size() ==
+            0);
+  }
+}
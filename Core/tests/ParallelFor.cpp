@@ -0,0 +1,45 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ParallelFor.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "catch.hpp"
+
+TEST_CASE("ParallelFor", "[common]") {
+  SECTION("Runs each task exactly once") {
+    for (std::size_t threadsCount : {0, 1, 2, 4, 16}) {
+      std::vector<std::atomic<int>> runs(100);
+      for (auto &run : runs) run = 0;
+
+      gd::ParallelFor(
+          runs.size(), threadsCount, [&](std::size_t i) { runs[i]++; });
+
+      for (auto &run : runs) REQUIRE(run == 1);
+    }
+  }
+
+  SECTION("Handles no tasks") {
+    bool called = false;
+    gd::ParallelFor(0, 4, [&](std::size_t i) { called = true; });
+    REQUIRE(!called);
+  }
+
+  SECTION("Rethrows an exception thrown by a task") {
+    std::atomic<int> runsCount(0);
+    REQUIRE_THROWS_AS(gd::ParallelFor(10, 4,
+                                      [&](std::size_t i) {
+                                        runsCount++;
+                                        if (i == 3)
+                                          throw std::runtime_error("Error");
+                                      }),
+                      std::runtime_error);
+    // Other tasks are still run.
+    REQUIRE(runsCount == 10);
+  }
+}
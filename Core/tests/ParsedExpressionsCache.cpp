@@ -0,0 +1,93 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
+
+#include <memory>
+
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "catch.hpp"
+
+TEST_CASE("ParsedExpressionsCache", "[common][events]") {
+  auto &cache = gd::ParsedExpressionsCache::Get();
+  cache.SetEnabled(true);
+  cache.ResetCounters();
+
+  SECTION("Expressions with the same string share their tree") {
+    gd::Expression expression1("MyObject.X() + 1");
+    gd::Expression expression2("MyObject.X() + 1");
+    gd::Expression expression3("MyObject.Y() + 1");
+
+    REQUIRE(expression1.GetRootNode() != nullptr);
+    REQUIRE(expression1.GetRootNode() == expression2.GetRootNode());
+    REQUIRE(expression1.GetRootNode() != expression3.GetRootNode());
+    REQUIRE(cache.GetMissesCount() == 2);
+    REQUIRE(cache.GetHitsCount() == 1);
+
+    // Copies share the tree without using the cache.
+    gd::Expression copiedExpression(expression1);
+    gd::Expression assignedExpression;
+    assignedExpression = expression3;
+    REQUIRE(copiedExpression.GetRootNode() == expression1.GetRootNode());
+    REQUIRE(assignedExpression.GetRootNode() == expression3.GetRootNode());
+    REQUIRE(cache.GetMissesCount() == 2);
+    REQUIRE(cache.GetHitsCount() == 1);
+  }
+
+  SECTION("Trees are destroyed with the last expression using them") {
+    std::unique_ptr<gd::Expression> expression(
+        new gd::Expression("MyObject.Z() + 2"));
+    expression->GetRootNode();
+    REQUIRE(cache.GetMissesCount() == 1);
+
+    expression.reset(new gd::Expression("MyObject.Z() + 2"));
+    expression->GetRootNode();
+    REQUIRE(cache.GetHitsCount() == 0);
+    REQUIRE(cache.GetMissesCount() == 2);
+  }
+
+  SECTION("Unshared trees can be modified") {
+    gd::Expression expression1("1 + MyVariable");
+    gd::Expression expression2("1 + MyVariable");
+    gd::Expression copiedExpression(expression1);
+    auto *sharedNode = expression2.GetRootNode();
+    REQUIRE(copiedExpression.GetRootNode() == sharedNode);
+
+    auto *unsharedNode = expression1.GetUnsharedRootNode();
+    REQUIRE(unsharedNode != sharedNode);
+    REQUIRE(expression1.GetRootNode() == unsharedNode);
+    REQUIRE(expression1.GetUnsharedRootNode() == unsharedNode);
+
+    auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*unsharedNode);
+    auto &identifierNode =
+        dynamic_cast<gd::IdentifierNode &>(*operatorNode.rightHandSide);
+    identifierNode.identifierName = "MyOtherVariable";
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *expression1.GetRootNode()) == "1 + MyOtherVariable");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *expression2.GetRootNode()) == "1 + MyVariable");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *copiedExpression.GetRootNode()) == "1 + MyVariable");
+
+    // A tree shared with a copy is not modifiable anymore.
+    gd::Expression copyOfUnsharedExpression(expression1);
+    REQUIRE(expression1.GetUnsharedRootNode() != unsharedNode);
+    REQUIRE(copyOfUnsharedExpression.GetRootNode() == unsharedNode);
+  }
+
+  SECTION("Disabled cache") {
+    cache.SetEnabled(false);
+    gd::Expression expression1("MyObject.X() + 3");
+    gd::Expression expression2("MyObject.X() + 3");
+    REQUIRE(expression1.GetRootNode() != expression2.GetRootNode());
+    REQUIRE(cache.GetHitsCount() == 0);
+    REQUIRE(cache.GetMissesCount() == 0);
+    cache.SetEnabled(true);
+  }
+
+  cache.ResetCounters();
+}
@@ -0,0 +1,150 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectExportOverlay.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void SetupProject(gd::Project &project) {
+  project.GetResourcesManager().AddResource(
+      "MyImage", "path/to/image.png", "image");
+  project.GetResourcesManager().AddResource(
+      "MySound", "path/to/sound.wav", "audio");
+
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  gd::StandardEvent standardEvent;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomethingWithResources");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(1, "MyImage");
+  instruction.SetParameter(2, "MySound");
+  standardEvent.GetActions().Insert(instruction);
+  layout.GetEvents().InsertEvent(standardEvent);
+
+  auto &object = layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyObject", 0);
+  object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior")
+      ->SetDefaultBehavior(true);
+  project.GetObjects().GetObjectGroups().InsertNew("MyGroup");
+  project.InsertNewExternalEvents("MyExternalEvents", 0);
+
+  auto &usedExtension =
+      project.InsertNewEventsFunctionsExtension("UsedExtension", 0);
+  usedExtension.SetFullName("Used extension");
+  usedExtension.GetEventsFunctions().InsertNewEventsFunction("MyFunction", 0);
+  usedExtension.GetEventsBasedObjects().InsertNew("MyEventsBasedObject", 0);
+  project.InsertNewEventsFunctionsExtension("UselessExtension", 1);
+  project.InsertNewEventsFunctionsExtension("ExtensionWithVariables", 2)
+      .GetGlobalVariables()
+      .InsertNew("MyVariable");
+}
+
+gd::String SerializeToJSON(const gd::Project &project) {
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+  return gd::Serializer::ToJSON(element);
+}
+
+}  // namespace
+
+TEST_CASE("ProjectExportOverlay", "[common]") {
+  SECTION("Strips the project and restores it") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    SetupProject(project);
+    gd::String originalJSON = SerializeToJSON(project);
+    const auto *originalEvent = &project.GetLayout("Scene").GetEvents().GetEvent(0);
+
+    {
+      gd::ProjectExportOverlay projectExportOverlay(project);
+      projectExportOverlay.StripProjectForExport();
+
+      REQUIRE(project.GetLayout("Scene").GetEvents().IsEmpty());
+      REQUIRE(project.GetObjects().GetObjectGroups().size() == 0);
+      REQUIRE(project.GetExternalEventsCount() == 0);
+      REQUIRE(!project.GetLayout("Scene")
+                   .GetObjects()
+                   .GetObject("MyObject")
+                   .GetBehavior("MyBehavior")
+                   .IsDefaultBehavior());
+      REQUIRE(project.GetEventsFunctionsExtensionsCount() == 2);
+      REQUIRE(project.GetEventsFunctionsExtension(0).GetName() ==
+              "UsedExtension");
+      REQUIRE(project.GetEventsFunctionsExtension(0).GetFullName() == "");
+      REQUIRE(project.GetEventsFunctionsExtension(0)
+                  .GetEventsFunctions()
+                  .GetEventsFunctionsCount() == 0);
+      REQUIRE(project.GetEventsFunctionsExtension(1).GetName() ==
+              "ExtensionWithVariables");
+    }
+
+    REQUIRE(SerializeToJSON(project) == originalJSON);
+    // Events are not copied.
+    REQUIRE(&project.GetLayout("Scene").GetEvents().GetEvent(0) ==
+            originalEvent);
+  }
+
+  SECTION("Restores resources and properties") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    SetupProject(project);
+    gd::String originalJSON = SerializeToJSON(project);
+    const auto *originalResource =
+        &project.GetResourcesManager().GetResource("MyImage");
+
+    {
+      gd::ProjectExportOverlay projectExportOverlay(project);
+      projectExportOverlay.PreserveResourcesAndProperties();
+
+      project.GetResourcesManager()
+          .GetResource("MyImage")
+          .SetFile("/absolute/path/to/image.png");
+      project.GetResourcesManager().AddResource(
+          "AddedFont", "font.ttf", "font");
+      project.GetAuthorIds().push_back("fallback-author");
+      project.GetWatermark().ShowGDevelopWatermark(false);
+    }
+
+    REQUIRE(SerializeToJSON(project) == originalJSON);
+    REQUIRE(&project.GetResourcesManager().GetResource("MyImage") ==
+            originalResource);
+    REQUIRE(!project.GetResourcesManager().HasResource("AddedFont"));
+  }
+
+  SECTION("Can't be used on projects with events referring to files") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    SetupProject(project);
+    REQUIRE(gd::ProjectExportOverlay::CanBeUsedOn(project));
+
+    // Old projects could refer to audio files without a resource.
+    gd::StandardEvent standardEvent;
+    gd::Instruction instruction;
+    instruction.SetType("MyExtension::DoSomethingWithResources");
+    instruction.SetParametersCount(3);
+    instruction.SetParameter(2, "path/to/music.ogg");
+    standardEvent.GetActions().Insert(instruction);
+    project.GetLayout("Scene").GetEvents().InsertEvent(standardEvent);
+    REQUIRE(!gd::ProjectExportOverlay::CanBeUsedOn(project));
+  }
+}
@@ -0,0 +1,253 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+
+#include <map>
+#include <mutex>
+#include <set>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * A file system keeping the files in memory, counting the operations done.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  virtual void MkDir(const gd::String& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    directories.insert(path);
+    mkDirCount++;
+  };
+  virtual bool DirExists(const gd::String& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return directories.find(path) != directories.end();
+  };
+  virtual bool FileExists(const gd::String& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return files.find(path) != files.end();
+  };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    std::size_t slashPos = file.find_last_of("/");
+    return slashPos == gd::String::npos ? file : file.substr(slashPos + 1);
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    std::size_t slashPos = file.find_last_of("/");
+    return slashPos == gd::String::npos ? "" : file.substr(0, slashPos);
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (filename.find(baseDirectory + "/") != 0) return false;
+    filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (files.find(file) == files.end()) return false;
+    files[destination] = File{files[file].content, ++time};
+    copyCount++;
+    return true;
+  }
+  virtual bool LinkFile(const gd::String& file, const gd::String& destination) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!supportsLinks || files.find(file) == files.end()) return false;
+    files[destination] = File{files[file].content, ++time};
+    linkCount++;
+    return true;
+  }
+  virtual bool GetFileInfo(const gd::String& file, FileInfo& fileInfo) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(file);
+    if (!supportsFileInfo || it == files.end()) return false;
+    fileInfo.size = it->second.content.size();
+    fileInfo.modificationTime = it->second.modificationTime;
+    return true;
+  }
+  virtual bool SupportsConcurrentAccess() { return true; }
+  virtual bool ClearDir(const gd::String& directory) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = files.begin(); it != files.end();) {
+      if (it->first.find(directory + "/") == 0)
+        it = files.erase(it);
+      else
+        ++it;
+    }
+    return true;
+  }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    std::lock_guard<std::mutex> lock(mutex);
+    files[file] = File{content, ++time};
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return files[file].content;
+  }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return {};
+  }
+
+  struct File {
+    gd::String content;
+    int64_t modificationTime;
+  };
+
+  std::map<gd::String, File> files;
+  std::set<gd::String> directories;
+  std::size_t mkDirCount = 0;
+  std::size_t copyCount = 0;
+  std::size_t linkCount = 0;
+  bool supportsFileInfo = true;
+  bool supportsLinks = false;
+
+ private:
+  std::mutex mutex;
+  int64_t time = 0;
+};
+
+void SetUpProject(gd::Project& project, InMemoryFileSystem& fs) {
+  project.SetProjectFile("/project/game.json");
+  auto& resourcesManager = project.GetResourcesManager();
+  resourcesManager.AddResource("Image1", "images/image1.png", "image");
+  resourcesManager.AddResource("Image2", "images/image2.png", "image");
+  resourcesManager.AddResource("Image3", "images/player/image3.png", "image");
+  resourcesManager.AddResource("Audio1", "audio1.mp3", "audio");
+
+  fs.WriteToFile("/project/images/image1.png", "Image 1");
+  fs.WriteToFile("/project/images/image2.png", "Image 2");
+  fs.WriteToFile("/project/images/player/image3.png", "Image 3");
+  fs.WriteToFile("/project/audio1.mp3", "Audio 1");
+}
+
+}  // namespace
+
+TEST_CASE("ProjectResourcesCopier", "[common]") {
+  SECTION("Copy resources, creating each directory once") {
+    gd::Project project;
+    InMemoryFileSystem fs;
+    SetUpProject(project, fs);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+
+    REQUIRE(fs.copyCount == 4);
+    REQUIRE(fs.files["/export/images/image1.png"].content == "Image 1");
+    REQUIRE(fs.files["/export/images/image2.png"].content == "Image 2");
+    REQUIRE(fs.files["/export/images/player/image3.png"].content ==
+            "Image 3");
+    REQUIRE(fs.files["/export/audio1.mp3"].content == "Audio 1");
+    REQUIRE(fs.mkDirCount == 3 + 1);  // Including the manifest directory.
+
+    // The original project is unchanged.
+    REQUIRE(project.GetResourcesManager().GetResource("Image1").GetFile() ==
+            "images/image1.png");
+  }
+
+  SECTION("Only copy files modified since the last copy") {
+    gd::Project project;
+    InMemoryFileSystem fs;
+    SetUpProject(project, fs);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 4);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 4);
+
+    // Modified source
+    fs.WriteToFile("/project/images/image2.png", "New image 2");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 5);
+    REQUIRE(fs.files["/export/images/image2.png"].content == "New image 2");
+
+    // Modified destination
+    fs.WriteToFile("/export/audio1.mp3", "Something else");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 6);
+    REQUIRE(fs.files["/export/audio1.mp3"].content == "Audio 1");
+
+    // Cleared destination
+    fs.ClearDir("/export");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 10);
+
+    // Another destination
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export2",
+                                                   false);
+    REQUIRE(fs.copyCount == 14);
+    REQUIRE(fs.files["/export2/images/image2.png"].content == "New image 2");
+  }
+
+  SECTION("Always copy files if the file system gives no information") {
+    gd::Project project;
+    InMemoryFileSystem fs;
+    fs.supportsFileInfo = false;
+    SetUpProject(project, fs);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 8);
+    REQUIRE(fs.mkDirCount == 3);  // No manifest is stored.
+  }
+
+  SECTION("Link files when supported") {
+    gd::Project project;
+    InMemoryFileSystem fs;
+    fs.supportsLinks = true;
+    SetUpProject(project, fs);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   false);
+    REQUIRE(fs.copyCount == 0);
+    REQUIRE(fs.linkCount == 4);
+    REQUIRE(fs.files["/export/images/player/image3.png"].content ==
+            "Image 3");
+  }
+
+  SECTION("Copy files with several threads") {
+    gd::Project project;
+    InMemoryFileSystem fs;
+    SetUpProject(project, fs);
+    for (std::size_t i = 0; i < 100; ++i) {
+      gd::String name = "Image" + gd::String::From(i + 10);
+      project.GetResourcesManager().AddResource(
+          name, "images/" + name + ".png", "image");
+      fs.WriteToFile("/project/images/" + name + ".png", name);
+    }
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   true, true, true, 4);
+    REQUIRE(fs.copyCount == 104);
+    REQUIRE(fs.files["/export/images/Image42.png"].content == "Image42");
+    REQUIRE(project.GetResourcesManager().GetResource("Image42").GetFile() ==
+            "images/Image42.png");
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(project, fs, "/export",
+                                                   true, true, true, 4);
+    REQUIRE(fs.copyCount == 104);
+  }
+}
@@ -32,4 +32,49 @@ TEST_CASE("Resources", "[common][resources]") {
     image.SetFile("Lots\\\\Of\\\\\\..\\Backslashs");
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
+  SECTION("Find resources by name") {
+    gd::ResourcesContainer resources(gd::ResourcesContainer::SourceType::Global);
+    resources.AddResource("MyResource1", "file1.png", "image");
+    resources.AddResource("MyResource2", "file2.png", "image");
+    gd::ImageResource image;
+    image.SetName("MyResource3");
+    resources.AddResource(image);
+    REQUIRE(!resources.AddResource("MyResource1", "file4.png", "image"));
+
+    REQUIRE(resources.HasResource("MyResource1"));
+    REQUIRE(resources.HasResource("MyResource3"));
+    REQUIRE(!resources.HasResource("MyResource4"));
+    REQUIRE(resources.GetResource("MyResource2").GetFile() == "file2.png");
+    REQUIRE(resources.GetResourcePosition("MyResource3") == 2);
+
+    resources.MoveResource(2, 0);
+    REQUIRE(resources.GetResourcePosition("MyResource3") == 0);
+    REQUIRE(resources.GetResourcePosition("MyResource1") == 1);
+
+    resources.RenameResource("MyResource1", "MyRenamedResource");
+    REQUIRE(!resources.HasResource("MyResource1"));
+    REQUIRE(resources.GetResource("MyRenamedResource").GetFile() ==
+            "file1.png");
+
+    resources.GetResource("MyResource2").SetName("MyOtherRenamedResource");
+    REQUIRE(!resources.HasResource("MyResource2"));
+    REQUIRE(resources.GetResourceSPtr("MyOtherRenamedResource")->GetFile() ==
+            "file2.png");
+
+    resources.RemoveResource("MyRenamedResource");
+    REQUIRE(!resources.HasResource("MyRenamedResource"));
+    REQUIRE(resources.GetResourcePosition("MyOtherRenamedResource") == 1);
+    REQUIRE(resources.Count() == 2);
+
+    gd::SerializerElement element;
+    resources.SerializeTo(element);
+    gd::ResourcesContainer unserializedResources(
+        gd::ResourcesContainer::SourceType::Global);
+    unserializedResources.UnserializeFrom(element);
+    REQUIRE(unserializedResources.HasResource("MyResource3"));
+    REQUIRE(unserializedResources.HasResource("MyOtherRenamedResource"));
+
+    resources.Clear();
+    REQUIRE(!resources.HasResource("MyResource3"));
+  }
 }
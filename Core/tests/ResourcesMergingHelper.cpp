@@ -115,4 +115,30 @@ TEST_CASE("ResourcesMergingHelper", "[common]") {
     REQUIRE(resourcesFilenames["MakeAbsolute(subfolder/image3.png)"] ==
             "MakeRelative(MakeAbsolute(subfolder/image3.png))");
   }
+  SECTION("Can compute new filenames without updating the project") {
+    gd::Project project;
+    MockFileSystem fs;
+    gd::ResourcesMergingHelper resourcesMerger(project.GetResourcesManager(), fs);
+    resourcesMerger.SetBaseDirectory("/game/base/folder/");
+    resourcesMerger.PreserveDirectoriesStructure(true);
+    resourcesMerger.SetShouldUpdateFilenames(false);
+
+    project.GetResourcesManager().AddResource("Image1", "/image1.png", "image");
+    project.GetResourcesManager().AddResource(
+        "Image3", "subfolder/image3.png", "image");
+
+    gd::ResourceExposer::ExposeWholeProjectResources(project, resourcesMerger);
+
+    auto resourcesFilenames =
+        resourcesMerger.GetAllResourcesOldAndNewFilename();
+    REQUIRE(resourcesFilenames["MakeAbsolute(/image1.png)"] ==
+            "FileNameFrom(MakeAbsolute(/image1.png))");
+    REQUIRE(resourcesFilenames["MakeAbsolute(subfolder/image3.png)"] ==
+            "MakeRelative(MakeAbsolute(subfolder/image3.png))");
+
+    REQUIRE(project.GetResourcesManager().GetResource("Image1").GetFile() ==
+            "/image1.png");
+    REQUIRE(project.GetResourcesManager().GetResource("Image3").GetFile() ==
+            "subfolder/image3.png");
+  }
 }
@@ -7,6 +7,12 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
@@ -123,6 +129,71 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetStringAttribute("attr1") == "attr123");
     REQUIRE(element.GetStringAttribute("child1") == "value456");
   }
+
+  SECTION("Elements with a lot of children") {
+    SerializerElement element;
+    for (std::size_t i = 0; i < 100; ++i)
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+
+    REQUIRE(element.GetChildrenCount("child42") == 1);
+    REQUIRE(element.HasChild("child42"));
+    REQUIRE(!element.HasChild("child100"));
+    REQUIRE(element.HasChild("child100", "child99"));
+    REQUIRE(element.GetChild("child42").GetIntValue() == 42);
+    REQUIRE(element.GetChild("child100", 0, "child99").GetIntValue() == 99);
+
+    // Adding an existing child returns it.
+    element.AddChild("child42").SetIntValue(420);
+    REQUIRE(element.GetAllChildren().size() == 100);
+    REQUIRE(element.GetChild("child42").GetIntValue() == 420);
+
+    // Removing a child moves the next ones.
+    element.SetAttribute("child10", "attribute");
+    REQUIRE(!element.HasChild("child10"));
+    REQUIRE(element.GetAllChildren().size() == 99);
+    REQUIRE(element.GetChild("child11").GetIntValue() == 11);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+
+    element.AddChild("child100").SetIntValue(100);
+    REQUIRE(element.GetChild("child11").GetIntValue() == 11);
+    REQUIRE(element.GetChild("child100").GetIntValue() == 100);
+
+    SerializerElement copiedElement = element;
+    copiedElement.GetChild("child50").SetIntValue(500);
+    REQUIRE(copiedElement.GetChild("child50").GetIntValue() == 500);
+    REQUIRE(element.GetChild("child50").GetIntValue() == 50);
+
+    element.Clear();
+    REQUIRE(!element.HasChild("child50"));
+  }
+
+  SECTION("Arrays with children having different names") {
+    SerializerElement element;
+    element.ConsiderAsArrayOf("element", "oldElement");
+    element.AddChild("element").SetIntValue(0);
+    element.AddChild("").SetIntValue(1);
+    REQUIRE(element.GetChildrenCount() == 2);
+    REQUIRE(element.GetChild(1).GetIntValue() == 1);
+    REQUIRE(element.GetChild("element", 1, "oldElement").GetIntValue() == 1);
+
+    // Children added while the array had another children name are only
+    // counted when asking for this name.
+    SerializerElement otherElement;
+    otherElement.ConsiderAsArrayOf("element");
+    otherElement.AddChild("element").SetIntValue(0);
+    otherElement.ConsiderAsArrayOf("other");
+    otherElement.AddChild("other").SetIntValue(1);
+    otherElement.ConsiderAsArrayOf("element");
+    otherElement.AddChild("element").SetIntValue(2);
+    REQUIRE(otherElement.GetChildrenCount() == 2);
+    REQUIRE(otherElement.GetChild(1).GetIntValue() == 2);
+    REQUIRE(otherElement.GetChildrenCount("element", "other") == 3);
+    REQUIRE(otherElement.GetChild("element", 1, "other").GetIntValue() == 1);
+
+    otherElement.ConsiderAsArrayOf("element", "other");
+    REQUIRE(otherElement.GetChildrenCount() == 3);
+    REQUIRE(otherElement.GetChild(1).GetIntValue() == 1);
+  }
 }
 
 TEST_CASE("Serializer", "[common]") {
@@ -227,4 +298,122 @@ TEST_CASE("Serializer", "[common]") {
     gd::String json = Serializer::ToJSON(element);
     REQUIRE(json == "{\"hello\":\"world1\",\"ok\":true,\"hello2\":\"world2\"}");
   }
+
+  SECTION("Same results with and without a RapidJSON document") {
+    std::vector<gd::String> jsons = {
+        "",
+        "null",
+        "{\"a\":null,\"b\":[null,true,false]}",
+        "[1,-2,3.5,2147483648,-9007199254740993,18446744073709551615,1e300]",
+        "{\"a\":{\"b\":[[],{},[{\"c\":\"d\"}]]},\"e\":\"\\u00e9\\n\"}",
+        "{\"duplicated\":1,\"other\":2,\"duplicated\":{\"a\":3}}",
+        "{\"invalid\":",
+    };
+    for (const auto& json : jsons) {
+      SerializerElement element = Serializer::FromJSON(json);
+      SerializerElement documentElement =
+          Serializer::FromJSONUsingDocument(json);
+      REQUIRE(Serializer::ToJSON(element) ==
+              Serializer::ToJSONUsingDocument(documentElement));
+      REQUIRE(Serializer::ToJSON(documentElement) ==
+              Serializer::ToJSONUsingDocument(element));
+    }
+
+    SerializerElement element = Serializer::FromJSON("{\"b\":1,\"a\":2}");
+    element.SetAttribute("c", 3);
+    element.AddChild("undefined");
+    REQUIRE(Serializer::ToJSON(element) ==
+            Serializer::ToJSONUsingDocument(element));
+    Serializer::SetCanonicalMode(true);
+    REQUIRE(Serializer::ToJSON(element) == "{\"a\":2,\"b\":1,\"c\":3,"
+                                           "\"undefined\":{}}");
+    REQUIRE(Serializer::ToJSON(element) ==
+            Serializer::ToJSONUsingDocument(element));
+    Serializer::SetCanonicalMode(false);
+  }
+
+  SECTION("Unserializing JSON with numbers as doubles") {
+    SerializerElement element;
+    REQUIRE(Serializer::UnserializeFromJSON(
+        "{\"a\":3,\"b\":4294967296,\"c\":[1.5,-2]}", element, true));
+    REQUIRE(element.GetChild("a").GetValue().IsDouble());
+    REQUIRE(element.GetChild("a").GetDoubleValue() == 3);
+    REQUIRE(element.GetChild("b").GetDoubleValue() == 4294967296.0);
+    REQUIRE(element.GetChild("c").GetChild(0).GetDoubleValue() == 1.5);
+    REQUIRE(element.GetChild("c").GetChild(1).GetValue().IsDouble());
+    REQUIRE(element.GetChild("c").GetChild(1).GetDoubleValue() == -2);
+
+    SerializerElement intElement;
+    REQUIRE(Serializer::UnserializeFromJSON("{\"a\":3}", intElement, false));
+    REQUIRE(intElement.GetChild("a").GetValue().IsInt());
+
+    SerializerElement invalidElement;
+    REQUIRE(!Serializer::UnserializeFromJSON(
+        "{\"a\":3,", invalidElement, true));
+    REQUIRE(!invalidElement.HasChild("a"));
+  }
+
+  SECTION("Benchmark") {
+    // A project-like JSON of a few MB.
+    SerializerElement projectElement;
+    SerializerElement& layoutsElement = projectElement.AddChild("layouts");
+    layoutsElement.ConsiderAsArrayOf("layout");
+    for (std::size_t i = 0; i < 200; ++i) {
+      SerializerElement& layoutElement = layoutsElement.AddChild("layout");
+      layoutElement.SetAttribute("name", "Layout" + gd::String::From(i));
+      SerializerElement& instancesElement =
+          layoutElement.AddChild("instances");
+      instancesElement.ConsiderAsArrayOf("instance");
+      for (std::size_t j = 0; j < 100; ++j) {
+        SerializerElement& instanceElement =
+            instancesElement.AddChild("instance");
+        instanceElement.SetAttribute("name", "Object" + gd::String::From(j));
+        instanceElement.SetAttribute("x", j * 1.5);
+        instanceElement.SetAttribute("y", j * 2.0);
+        instanceElement.SetAttribute("zOrder", (int)j);
+        instanceElement.SetAttribute("locked", false);
+        instanceElement.SetAttribute("layer", "");
+        instanceElement.SetAttribute("persistentUuid",
+                                     "uuid-" + gd::String::From(i) + "-" +
+                                         gd::String::From(j));
+        instanceElement.AddChild("numberProperties").ConsiderAsArray();
+        instanceElement.AddChild("stringProperties").ConsiderAsArray();
+      }
+    }
+    gd::String json = Serializer::ToJSONUsingDocument(projectElement);
+
+    auto measure = [](const std::function<void()>& function) {
+      auto start = std::chrono::steady_clock::now();
+      function();
+      return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - start)
+          .count();
+    };
+
+    std::unique_ptr<SerializerElement> element;
+    std::unique_ptr<SerializerElement> documentElement;
+    auto fromJSONTime = measure([&]() {
+      element.reset(new SerializerElement(Serializer::FromJSON(json)));
+    });
+    auto fromJSONUsingDocumentTime = measure([&]() {
+      documentElement.reset(
+          new SerializerElement(Serializer::FromJSONUsingDocument(json)));
+    });
+
+    gd::String outputJson;
+    gd::String documentOutputJson;
+    auto toJSONTime =
+        measure([&]() { outputJson = Serializer::ToJSON(*element); });
+    auto toJSONUsingDocumentTime = measure([&]() {
+      documentOutputJson = Serializer::ToJSONUsingDocument(*documentElement);
+    });
+    REQUIRE(outputJson == json);
+    REQUIRE(documentOutputJson == json);
+
+    std::cout << "Serializer benchmark (" << json.size() / 1024
+              << " KB of JSON): FromJSON " << fromJSONTime
+              << " ms, FromJSONUsingDocument " << fromJSONUsingDocumentTime
+              << " ms, ToJSON " << toJSONTime << " ms, ToJSONUsingDocument "
+              << toJSONUsingDocumentTime << " ms" << std::endl;
+  }
 }
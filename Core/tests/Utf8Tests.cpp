@@ -142,6 +142,47 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(str.rfind(u8"té", 7) == std::string::npos);
   }
 
+  SECTION("positions in long strings") {
+    // Mix ASCII and non ASCII characters, so that characters positions are
+    // checked against their UTF32 counterparts on both.
+    gd::String str;
+    std::u32string u32str;
+    for (std::size_t i = 0; i < 100; ++i) {
+      gd::String part = i % 3 == 0   ? gd::String(u8"été ")
+                        : i % 3 == 1 ? gd::String("An ASCII only text ")
+                                     : gd::String(u8"日本語 ");
+      str += part;
+      u32str += part.ToUTF32();
+    }
+
+    REQUIRE(str.size() == u32str.size());
+    for (std::size_t i = 0; i < u32str.size(); i += 7) {
+      REQUIRE(str[i] == u32str[i]);
+      REQUIRE(str.substr(i, 9) == gd::String::FromUTF32(u32str.substr(i, 9)));
+
+      gd::String search = str.substr(i, 3);
+      REQUIRE(str.find(search, i) == u32str.find(search.ToUTF32(), i));
+      REQUIRE(str.find(search, i + 1) == u32str.find(search.ToUTF32(), i + 1));
+      REQUIRE(str.rfind(search, i) == u32str.rfind(search.ToUTF32(), i));
+    }
+
+    gd::String modifiedStr = str;
+    std::u32string modifiedU32Str = u32str;
+    modifiedStr.erase(10, 30);
+    modifiedU32Str.erase(10, 30);
+    modifiedStr.insert(25, u8"ß");
+    modifiedU32Str.insert(25, U"ß");
+    modifiedStr.replace(40, 12, "-");
+    modifiedU32Str.replace(40, 12, U"-");
+    REQUIRE(modifiedStr == gd::String::FromUTF32(modifiedU32Str));
+
+    REQUIRE(str.substr(u32str.size()) == "");
+    REQUIRE(str.find("", u32str.size()) == gd::String::npos);
+    #if !defined(WINDOWS)
+      REQUIRE_THROWS_AS(str.substr(u32str.size() + 1), std::out_of_range);
+    #endif
+  }
+
   SECTION("find_first/last(_not)_of") {
     gd::String str = u8"Arriveras-tu à trouver un caractère sans accent ?";
 
@@ -292,6 +333,11 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
 
     gd::String str6 = u8"ßßß";
     REQUIRE(str6.FindAndReplace(u8"ßß", u8"ß") == u8"ßß");
+
+    gd::String str7 = u8"Nothing to replace";
+    REQUIRE(str7.FindAndReplace(u8"ß", "SS") == str7);
+    REQUIRE(str7.FindAndReplace("Nothing", "") == " to replace");
+    REQUIRE(str7.FindAndReplace("e", u8"é") == u8"Nothing to réplacé");
   }
 
   SECTION("trimming") {
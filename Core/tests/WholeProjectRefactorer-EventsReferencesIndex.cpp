@@ -0,0 +1,226 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the refactorings using an index of the references
+ */
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::StandardEvent &InsertEventWithActions(
+    gd::Project &project, gd::EventsList &events, const gd::String &objectName,
+    const gd::String &expression) {
+  gd::StandardEvent &event = dynamic_cast<gd::StandardEvent &>(
+      events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+
+  gd::Instruction objectInstruction;
+  objectInstruction.SetType("MyExtension::DoSomethingWithObjects");
+  objectInstruction.SetParametersCount(2);
+  objectInstruction.SetParameter(0, objectName);
+  objectInstruction.SetParameter(1, "");
+  event.GetActions().Insert(objectInstruction);
+
+  gd::Instruction expressionInstruction;
+  expressionInstruction.SetType("MyExtension::DoSomething");
+  expressionInstruction.SetParametersCount(1);
+  expressionInstruction.SetParameter(0, expression);
+  event.GetActions().Insert(expressionInstruction);
+
+  return event;
+}
+
+void SetupProjectWithLotOfEvents(gd::Project &project, gd::Platform &platform,
+                                 std::size_t objectsCount,
+                                 std::size_t eventsCount) {
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+
+  for (std::size_t i = 0; i < objectsCount; ++i) {
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "Object" + gd::String::From(i), i);
+  }
+
+  for (std::size_t i = 0; i < eventsCount; ++i) {
+    gd::String objectName = "Object" + gd::String::From(i % objectsCount);
+    gd::String otherObjectName =
+        "Object" + gd::String::From((i * 7 + 3) % objectsCount);
+    auto &event = InsertEventWithActions(
+        project, layout.GetEvents(), objectName,
+        objectName + ".GetObjectNumber() + " + otherObjectName +
+            ".GetObjectNumber()");
+    InsertEventWithActions(project, event.GetSubEvents(), otherObjectName,
+                           "1 + " + objectName + ".GetObjectNumber()");
+  }
+}
+
+gd::String GetEventsJson(const gd::EventsList &events) {
+  gd::SerializerElement element;
+  gd::EventsListSerialization::SerializeEventsTo(events, element);
+  return gd::Serializer::ToJSON(element);
+}
+
+}  // namespace
+
+TEST_CASE("EventsReferencesIndex", "[common][events]") {
+  SECTION("Words") {
+    std::unordered_set<gd::String> words;
+    gd::EventsReferencesIndex::GetWords(
+        "MyObject.Variable[\"My child\"] + MyExtension::MyFunction(Été_1)",
+        words);
+
+    REQUIRE(words.size() == 7);
+    REQUIRE(words.count("MyObject") == 1);
+    REQUIRE(words.count("Variable") == 1);
+    REQUIRE(words.count("My") == 1);
+    REQUIRE(words.count("child") == 1);
+    REQUIRE(words.count("MyExtension") == 1);
+    REQUIRE(words.count("MyFunction") == 1);
+    REQUIRE(words.count("Été_1") == 1);
+  }
+
+  SECTION("Events referencing a symbol") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::EventsList events;
+
+    auto &event1 = InsertEventWithActions(project, events, "MyObject",
+                                          "OtherObject.GetObjectNumber()");
+    InsertEventWithActions(project, event1.GetSubEvents(), "MySubObject",
+                           "\"My text\"");
+    InsertEventWithActions(project, events, "", "1 + 2");
+
+    gd::EventsReferencesIndex index;
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(0), "MyObject"));
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(0), "OtherObject"));
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(0), "MySubObject"));
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(0), "My text"));
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(0),
+                               "MyExtension::DoSomething"));
+    REQUIRE_FALSE(index.MayReference(events.GetEventSmartPtr(0), "Object"));
+    REQUIRE_FALSE(index.MayReference(events.GetEventSmartPtr(0), "My layer"));
+    REQUIRE_FALSE(index.MayReference(events.GetEventSmartPtr(1), "MyObject"));
+    REQUIRE(index.GetIndexedEventsCount() == 2);
+
+    // Modified events are only seen once invalidated.
+    dynamic_cast<gd::StandardEvent &>(events[1])
+        .GetActions()[0]
+        .SetParameter(0, "MyObject");
+    REQUIRE_FALSE(index.MayReference(events.GetEventSmartPtr(1), "MyObject"));
+    index.InvalidateEvent(events[1]);
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(1), "MyObject"));
+
+    // Removed events are forgotten, even if another event is created at the
+    // same address.
+    events.RemoveEvent(1);
+    InsertEventWithActions(project, events, "YetAnotherObject", "");
+    REQUIRE(index.MayReference(events.GetEventSmartPtr(1),
+                               "YetAnotherObject"));
+  }
+
+  SECTION("Same results with and without an index") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithLotOfEvents(project, platform, 10, 50);
+    gd::Project indexedProject;
+    SetupProjectWithLotOfEvents(indexedProject, platform, 10, 50);
+    auto &layout = project.GetLayout("Scene");
+    auto &indexedLayout = indexedProject.GetLayout("Scene");
+
+    gd::EventsReferencesIndex index;
+    for (std::size_t i = 0; i < 10; ++i) {
+      gd::String oldName = "Object" + gd::String::From(i);
+      gd::String newName = "Renamed" + gd::String::From(i);
+      gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+          project, layout, oldName, newName, /* isObjectGroup=*/false);
+      gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+          indexedProject, indexedLayout, oldName, newName,
+          /* isObjectGroup=*/false, &index);
+
+      REQUIRE(GetEventsJson(layout.GetEvents()) ==
+              GetEventsJson(indexedLayout.GetEvents()));
+    }
+    auto &firstEvent =
+        dynamic_cast<gd::StandardEvent &>(indexedLayout.GetEvents()[0]);
+    REQUIRE(firstEvent.GetActions()[0].GetParameter(0).GetPlainString() ==
+            "Renamed0");
+    REQUIRE(firstEvent.GetActions()[1].GetParameter(0).GetPlainString() ==
+            "Renamed0.GetObjectNumber() + Renamed3.GetObjectNumber()");
+
+    // Events added after the index was built are renamed too.
+    InsertEventWithActions(indexedProject, indexedLayout.GetEvents(),
+                           "Object1", "Object1.GetObjectNumber()");
+    gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+        indexedProject, indexedLayout, "Object1", "Renamed1",
+        /* isObjectGroup=*/false, &index);
+    auto &lastEvent = dynamic_cast<gd::StandardEvent &>(
+        indexedLayout.GetEvents()[indexedLayout.GetEvents().size() - 1]);
+    REQUIRE(lastEvent.GetActions()[0].GetParameter(0).GetPlainString() ==
+            "Renamed1");
+    REQUIRE(lastEvent.GetActions()[1].GetParameter(0).GetPlainString() ==
+            "Renamed1.GetObjectNumber()");
+  }
+
+  SECTION("Benchmark") {
+    const std::size_t objectsCount = 200;
+    const std::size_t renamesCount = 50;
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithLotOfEvents(project, platform, objectsCount, 2000);
+    gd::Project indexedProject;
+    SetupProjectWithLotOfEvents(indexedProject, platform, objectsCount, 2000);
+
+    auto measure = [](const std::function<void()> &function) {
+      auto start = std::chrono::steady_clock::now();
+      function();
+      return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - start)
+          .count();
+    };
+
+    auto fullScanTime = measure([&]() {
+      for (std::size_t i = 0; i < renamesCount; ++i) {
+        gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+            project, project.GetLayout("Scene"),
+            "Object" + gd::String::From(i), "Renamed" + gd::String::From(i),
+            /* isObjectGroup=*/false);
+      }
+    });
+    gd::EventsReferencesIndex index;
+    auto indexedTime = measure([&]() {
+      for (std::size_t i = 0; i < renamesCount; ++i) {
+        gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+            indexedProject, indexedProject.GetLayout("Scene"),
+            "Object" + gd::String::From(i), "Renamed" + gd::String::From(i),
+            /* isObjectGroup=*/false, &index);
+      }
+    });
+
+    REQUIRE(GetEventsJson(project.GetLayout("Scene").GetEvents()) ==
+            GetEventsJson(indexedProject.GetLayout("Scene").GetEvents()));
+
+    std::cout << "Renaming " << renamesCount << " objects: " << fullScanTime
+              << "ms (browsing all events) vs " << indexedTime
+              << "ms (with an index of the references)." << std::endl;
+  }
+}
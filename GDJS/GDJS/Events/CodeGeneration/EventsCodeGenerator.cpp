@@ -8,6 +8,7 @@
 #include <algorithm>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/CodeWriter.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
@@ -78,27 +79,28 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   idToCallbackMapCode +=
       codeGenerator.GetCodeNamespace() + ".idToCallbackMap = new Map();\n";
 
-  gd::String output =
-      // clang-format off
-      codeGenerator.GetCodeNamespace() + " = {};\n" +
-      localVariablesInitializationCode +
-      idToCallbackMapCode +
-      globalDeclarations +
-      globalObjectLists + "\n\n" +
-      codeGenerator.GetCustomCodeOutsideMain() + "\n\n" +
-      fullyQualifiedFunctionName + " = function(" +
-        functionArgumentsCode +
-      ") {\n" +
-        functionPreEventsCode + "\n" +
-        globalObjectListsReset + "\n" +
-        wholeEventsCode + "\n" +
-        globalObjectListsReset + "\n" +
-        functionPostEventsCode + "\n" +
-        functionReturnCode + "\n" +
-      "}\n";
+  gd::CodeWriter output;
+  // clang-format off
+  output <<
+    codeGenerator.GetCodeNamespace() << " = {};\n" <<
+    localVariablesInitializationCode <<
+    idToCallbackMapCode <<
+    globalDeclarations <<
+    globalObjectLists << "\n\n" <<
+    codeGenerator.GetCustomCodeOutsideMain() << "\n\n" <<
+    fullyQualifiedFunctionName << " = function(" <<
+      functionArgumentsCode <<
+    ") {\n" <<
+      functionPreEventsCode << "\n" <<
+      globalObjectListsReset << "\n" <<
+      std::move(wholeEventsCode) << "\n" <<
+      globalObjectListsReset << "\n" <<
+      functionPostEventsCode << "\n" <<
+      functionReturnCode << "\n" <<
+    "}\n";
   // clang-format on
 
-  return output;
+  return output.ToString();
 }
 
 gd::String EventsCodeGenerator::GenerateLayoutCode(
@@ -1214,8 +1216,8 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // List of objects, conditions booleans and any variables used by events
   // are stored in static variables that are globally available by the whole
   // code.
-  AddCustomCodeOutsideMain(functionName + " = function(" + parametersCode +
-                           ") {\n" + code + "\n" + "};");
+  customCodeOutsideMain << functionName << " = function(" << parametersCode
+                        << ") {\n" << std::move(code) << "\n" << "};";
 
   // Replace the code of the events by the call to the function. This does not
   // interfere with the objects picking as the lists are in static variables
@@ -20,11 +20,12 @@ gd::String LayoutCodeGenerator::GenerateLayoutCompleteCode(
   gd::String layoutCode = EventsCodeGenerator::GenerateLayoutCode(
       project, layout, codeNamespace, includeFiles, diagnosticReport, compilationForRuntime);
 
-  // Export the symbols to avoid them being stripped by the Closure Compiler:
-  gd::String exportCode =
-      "gdjs['" + sceneMangledName + "Code']" + " = " + codeNamespace + ";\n";
+  // Export the symbols to avoid them being stripped by the Closure Compiler.
+  // The code is appended in place to avoid copying the whole layout code.
+  layoutCode +=
+      "\ngdjs['" + sceneMangledName + "Code']" + " = " + codeNamespace + ";\n";
 
-  return layoutCode + "\n" + exportCode;
+  return layoutCode;
 }
 
 }  // namespace gdjs
@@ -0,0 +1,161 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/EventsCodeCache.h"
+
+#include <set>
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gdjs {
+
+EventsCodeCache *EventsCodeCache::singleton = nullptr;
+
+namespace {
+
+/**
+ * Add the names of the scenes linked (with a link event) by the events to
+ * \a targets.
+ */
+void FindLinkTargets(const gd::EventsList &events,
+                     std::set<gd::String> &targets) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent &event = events.GetEvent(i);
+    const gd::LinkEvent *linkEvent = dynamic_cast<const gd::LinkEvent *>(&event);
+    if (linkEvent) targets.insert(linkEvent->GetTarget());
+
+    if (event.CanHaveSubEvents())
+      FindLinkTargets(event.GetSubEvents(), targets);
+  }
+}
+
+/**
+ * 64-bit FNV-1a hash, stable across runs and platforms.
+ */
+void HashBytes(const gd::String &string, std::uint64_t &hash) {
+  for (unsigned char byte : string.Raw()) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+  // Separate the hashed strings from each other.
+  hash ^= 0xff;
+  hash *= 1099511628211ULL;
+}
+
+void HashElement(const gd::SerializerElement &element, std::uint64_t &hash) {
+  HashBytes(gd::Serializer::ToJSON(element), hash);
+}
+
+}  // namespace
+
+std::uint64_t EventsCodeCache::ComputeSceneHash(const gd::Project &project,
+                                                const gd::Layout &layout,
+                                                bool exportForPreview) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  HashBytes(exportForPreview ? "preview" : "export", hash);
+  HashBytes(gd::String::From(
+                project.GetCurrentPlatform().GetMetadataRevision()),
+            hash);
+
+  // Global objects, groups and variables are used by all scenes.
+  {
+    gd::SerializerElement element;
+    project.GetObjects().SerializeObjectsTo(element.AddChild("objects"));
+    project.GetObjects().GetObjectGroups().SerializeTo(
+        element.AddChild("objectsGroups"));
+    project.GetVariables().SerializeTo(element.AddChild("variables"));
+    HashElement(element, hash);
+  }
+
+  // External events can be linked by the scene (directly or by other external
+  // events). They are all included as finding which ones are used is not
+  // worth it.
+  std::set<gd::String> linkedLayoutNames;
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    const gd::ExternalEvents &externalEvents = project.GetExternalEvents(i);
+    HashBytes(externalEvents.GetName(), hash);
+    HashBytes(externalEvents.GetAssociatedLayout(), hash);
+
+    gd::SerializerElement element;
+    gd::EventsListSerialization::SerializeEventsTo(externalEvents.GetEvents(),
+                                                   element);
+    HashElement(element, hash);
+
+    FindLinkTargets(externalEvents.GetEvents(), linkedLayoutNames);
+  }
+
+  // The scene itself.
+  HashBytes(layout.GetName(), hash);
+  {
+    gd::SerializerElement element;
+    gd::EventsListSerialization::SerializeEventsTo(layout.GetEvents(),
+                                                   element.AddChild("events"));
+    layout.GetObjects().SerializeObjectsTo(element.AddChild("objects"));
+    layout.GetObjects().GetObjectGroups().SerializeTo(
+        element.AddChild("objectsGroups"));
+    layout.GetVariables().SerializeTo(element.AddChild("variables"));
+    HashElement(element, hash);
+  }
+
+  // Events of the other scenes linked by the scene.
+  FindLinkTargets(layout.GetEvents(), linkedLayoutNames);
+  std::set<gd::String> hashedLayoutNames;
+  hashedLayoutNames.insert(layout.GetName());
+  while (!linkedLayoutNames.empty()) {
+    gd::String linkedLayoutName = *linkedLayoutNames.begin();
+    linkedLayoutNames.erase(linkedLayoutNames.begin());
+    if (!project.HasLayoutNamed(linkedLayoutName) ||
+        !hashedLayoutNames.insert(linkedLayoutName).second)
+      continue;
+
+    const gd::EventsList &linkedEvents =
+        project.GetLayout(linkedLayoutName).GetEvents();
+    HashBytes(linkedLayoutName, hash);
+    gd::SerializerElement element;
+    gd::EventsListSerialization::SerializeEventsTo(linkedEvents, element);
+    HashElement(element, hash);
+
+    FindLinkTargets(linkedEvents, linkedLayoutNames);
+  }
+
+  return hash;
+}
+
+const EventsCodeCache::SceneCode *EventsCodeCache::GetSceneCode(
+    const gd::String &filename, std::uint64_t hash) const {
+  auto it = scenesCode.find(filename);
+  if (it == scenesCode.end() || it->second.hash != hash) return nullptr;
+
+  return &it->second;
+}
+
+void EventsCodeCache::StoreSceneCode(const gd::String &filename,
+                                     SceneCode &&sceneCode) {
+  scenesCode[filename] = std::move(sceneCode);
+}
+
+EventsCodeCache &EventsCodeCache::Get() {
+  if (!singleton) singleton = new EventsCodeCache;
+
+  return *singleton;
+}
+
+void EventsCodeCache::DestroySingleton() {
+  if (singleton) {
+    delete singleton;
+    singleton = nullptr;
+  }
+}
+
+}  // namespace gdjs
@@ -0,0 +1,87 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class Layout;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Keep the events code generated for the scenes, so that it can be
+ * reused by the next exports if the scenes did not change.
+ *
+ * Generated code is stored by output filename, along with a hash of
+ * everything used to generate it (see
+ * gdjs::EventsCodeCache::ComputeSceneHash).
+ *
+ * \see gdjs::ExporterHelper::ExportScenesEventsCode
+ */
+class GD_API EventsCodeCache {
+ public:
+  /**
+   * \brief The code generated for a scene.
+   */
+  struct SceneCode {
+    std::uint64_t hash = 0;
+    gd::String eventsOutput;
+    std::set<gd::String> eventsIncludes;
+    std::vector<gd::ProjectDiagnostic> diagnostics;
+  };
+
+  /**
+   * \brief Compute a hash of everything the code generated for a scene
+   * depends on.
+   *
+   * This includes the events, objects, groups and variables of the scene and
+   * of the project, the external events and the events of the scenes linked
+   * by the scene, and the revision of the platform extensions metadata.
+   */
+  static std::uint64_t ComputeSceneHash(const gd::Project &project,
+                                        const gd::Layout &layout,
+                                        bool exportForPreview);
+
+  /**
+   * \brief Return the code previously generated for \a filename, or nullptr
+   * if there is none or if it was generated from a scene with another hash.
+   */
+  const SceneCode *GetSceneCode(const gd::String &filename,
+                                std::uint64_t hash) const;
+
+  /**
+   * \brief Store the code generated for \a filename, replacing any previous
+   * one.
+   */
+  void StoreSceneCode(const gd::String &filename, SceneCode &&sceneCode);
+
+  /**
+   * \brief Forget all the generated code.
+   */
+  void Clear() { scenesCode.clear(); };
+
+  static EventsCodeCache &Get();
+  static void DestroySingleton();
+
+ private:
+  EventsCodeCache(){};
+  virtual ~EventsCodeCache(){};
+
+  std::map<gd::String, SceneCode> scenesCode;
+
+  static EventsCodeCache *singleton;
+};
+
+}  // namespace gdjs
@@ -51,11 +51,13 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
   return helper.ExportProjectForPixiPreview(options, includesFiles);
 }
 
 bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
   gd::Project exportedProject = options.project;
 
   auto usedExtensionsResult =
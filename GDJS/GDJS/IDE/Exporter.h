@@ -65,6 +65,16 @@ class Exporter {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Set the number of threads used to generate the events code of the
+   * scenes (1 by default).
+   *
+   * \see ExporterHelper::SetCodeGenerationThreadsCount
+   */
+  void SetCodeGenerationThreadsCount(std::size_t codeGenerationThreadsCount_) {
+    codeGenerationThreadsCount = codeGenerationThreadsCount_;
+  }
+
   /**
    * \brief Serialize a project without its events to JSON
    *
@@ -99,6 +109,8 @@ private:
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount =
+      1;  ///< The number of threads used to generate the scenes events code.
   std::vector<gd::String>
       includesFiles; ///< The list of scripts files - useful for hot-reloading
 };
@@ -21,6 +21,7 @@
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/InGameEditorResourceMetadata.h"
@@ -33,7 +34,7 @@
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
 #include "GDCore/IDE/Project/SceneResourcesFinder.h"
-#include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/IDE/ProjectExportOverlay.h"
 #include "GDCore/IDE/ResourceExposer.h"
 #include "GDCore/IDE/SceneNameMangler.h"
 #include "GDCore/Project/EventsBasedObject.h"
@@ -47,8 +48,11 @@
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/ParallelFor.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/EventsCodeCache.h"
 #undef CopyFile  // Disable an annoying macro
 
 namespace {
@@ -81,20 +85,16 @@ static void InsertUniqueFirst(std::vector<gd::String> &container, gd::String str
 }
 
 static gd::String CleanProjectName(gd::String projectName) {
-  gd::String partiallyCleanedProjectName = projectName;
+  gd::String partiallyCleanedProjectName;
 
   static const gd::String forbiddenFileNameCharacters =
       "\\/:*?\"<>|";  // See
                       // https://learn.microsoft.com/en-us/windows/win32/fileio/naming-a-file
 
-  for (size_t i = 0; i < partiallyCleanedProjectName.size();) {
-    // Delete all characters that are not allowed in a filename
-    if (forbiddenFileNameCharacters.find(partiallyCleanedProjectName[i]) !=
-        gd::String::npos) {
-      partiallyCleanedProjectName.erase(i, 1);
-    } else {
-      i++;
-    }
+  // Delete all characters that are not allowed in a filename
+  for (char32_t character : projectName) {
+    if (forbiddenFileNameCharacters.find(character) == gd::String::npos)
+      partiallyCleanedProjectName.push_back(character);
   }
 
   if (partiallyCleanedProjectName.empty())
@@ -129,11 +129,26 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
   std::vector<gd::InGameEditorResourceMetadata> inGameEditorResources;
 
-  // TODO Try to remove side effects to avoid the copy
-  // that destroys the AST in cache.
-  gd::Project exportedProject = options.project;
+  // The export modifies the project (resources filenames, loading screen...):
+  // these changes are done on the project itself and rolled back at the end
+  // of the export, so that the project is not copied (which would also
+  // destroy the ASTs in cache).
+  // Old projects can have events referring directly to files, which would be
+  // modified: the project is cloned in this case.
+  std::unique_ptr<gd::Project> clonedProject;
+  std::unique_ptr<gd::ProjectExportOverlay> projectExportOverlay;
+  if (gd::ProjectExportOverlay::CanBeUsedOn(options.project)) {
+    projectExportOverlay =
+        gd::make_unique<gd::ProjectExportOverlay>(options.project);
+    projectExportOverlay->PreserveResourcesAndProperties();
+    previousTime = LogTimeSpent("Project export overlay", previousTime);
+  } else {
+    clonedProject = gd::make_unique<gd::Project>(options.project);
+    previousTime = LogTimeSpent("Project cloning", previousTime);
+  }
+  gd::Project &exportedProject =
+      clonedProject ? *clonedProject : options.project;
   const gd::Project &immutableProject = options.project;
-  previousTime = LogTimeSpent("Project cloning", previousTime);
 
   if (options.isInGameEdition) {
     if (options.shouldReloadProjectData ||
@@ -278,10 +293,17 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                           codeOutputDir,
                           includesFiles,
                           wholeProjectDiagnosticReport,
-                          true)) {
+                          true,
+                          options.shouldUseEventsCodeCache)) {
       return false;
     }
-    previousTime = LogTimeSpent("Events code export", previousTime);
+    previousTime = LogTimeSpent(
+        "Events code export (" +
+            gd::String::From(reusedScenesEventsCodeCount) +
+            " scenes reused from cache, " +
+            gd::String::From(generatedScenesEventsCodeCount) +
+            " scenes generated)",
+        previousTime);
   }
   else {
     gd::LogStatus("Events code export is skipped");
@@ -621,10 +643,13 @@ void ExporterHelper::StripAndSerializeProjectData(
   }
 
   // Strip the project (*after* generating events as the events may use stripped
-  // things (objects groups...))
-  gd::ProjectStripper::StripProjectForExport(project);
-
-  project.SerializeTo(rootElement);
+  // things (objects groups...)). The stripped parts are restored once the
+  // project is serialized.
+  {
+    gd::ProjectExportOverlay projectExportOverlay(project);
+    projectExportOverlay.StripProjectForExport();
+    project.SerializeTo(rootElement);
+  }
   SerializeUsedResourcesForRuntime(project, rootElement, projectUsedResources,
                          scenesUsedResources);
   if (isInGameEdition) {
@@ -1336,45 +1361,110 @@ static std::size_t CountEventsRecursively(const gd::EventsList &events) {
   return count;
 }
 
+static gd::String GetSceneCodeFilename(const gd::String &outputDir,
+                                       std::size_t layoutIndex) {
+  return outputDir + "/" + "code" + gd::String::From(layoutIndex) + ".js";
+}
+
 bool ExporterHelper::ExportScenesEventsCode(
     const gd::Project &project,
     gd::String outputDir,
     std::vector<gd::String> &includesFiles,
     gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
-    bool exportForPreview) {
+    bool exportForPreview,
+    bool useEventsCodeCache) {
   fs.MkDir(outputDir);
 
+  struct SceneCode {
+    EventsCodeCache::SceneCode generatedCode;
+    const EventsCodeCache::SceneCode *cachedCode = nullptr;
+    double timeSpent = 0;
+  };
+  std::vector<SceneCode> scenesCode(project.GetLayoutsCount());
+  EventsCodeCache &eventsCodeCache = EventsCodeCache::Get();
+
+  // Diagnostic reports are created upfront, in the order of the scenes, so
+  // that they don't depend on the order in which scenes are generated.
+  std::vector<gd::DiagnosticReport *> diagnosticReports;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    diagnosticReports.push_back(
+        &wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
+            project.GetLayout(i).GetName()));
+  }
+
+  // Scenes are generated independently: only lazily initialized shared data
+  // must be created before generating them in parallel.
+  project.GetCurrentPlatform().GetMetadataIndex();
+  EventsCodeNameMangler::Get();
+  gd::SceneNameMangler::Get();
+
+  gd::ParallelFor(
+      project.GetLayoutsCount(), codeGenerationThreadsCount,
+      [&](std::size_t i) {
+        SceneCode &sceneCode = scenesCode[i];
+        const gd::Layout &layout = project.GetLayout(i);
+        double sceneStartTime = GetTimeNow();
+        if (useEventsCodeCache) {
+          // The cache is only read while scenes are generated.
+          sceneCode.generatedCode.hash = EventsCodeCache::ComputeSceneHash(
+              project, layout, exportForPreview);
+          sceneCode.cachedCode = eventsCodeCache.GetSceneCode(
+              GetSceneCodeFilename(outputDir, i),
+              sceneCode.generatedCode.hash);
+        }
+        if (!sceneCode.cachedCode) {
+          LayoutCodeGenerator layoutCodeGenerator(project);
+          sceneCode.generatedCode.eventsOutput =
+              layoutCodeGenerator.GenerateLayoutCompleteCode(
+                  layout, sceneCode.generatedCode.eventsIncludes,
+                  *diagnosticReports[i], !exportForPreview);
+        }
+        sceneCode.timeSpent = GetTimeSpent(sceneStartTime);
+      });
+
+  reusedScenesEventsCodeCount = 0;
+  generatedScenesEventsCodeCount = 0;
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
-    std::set<gd::String> eventsIncludes;
     const gd::Layout &layout = project.GetLayout(i);
+    SceneCode &sceneCode = scenesCode[i];
+    gd::String filename = GetSceneCodeFilename(outputDir, i);
 
-    double sceneStartTime = GetTimeNow();
-    auto &diagnosticReport =
-        wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
-            layout.GetName());
-    LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, diagnosticReport, !exportForPreview);
-    gd::String filename =
-        outputDir + "/" + "code" + gd::String::From(i) + ".js";
+    if (sceneCode.cachedCode) {
+      reusedScenesEventsCodeCount++;
+      for (auto &diagnostic : sceneCode.cachedCode->diagnostics)
+        diagnosticReports[i]->Add(diagnostic);
+    } else {
+      generatedScenesEventsCodeCount++;
+    }
+    const EventsCodeCache::SceneCode &code =
+        sceneCode.cachedCode ? *sceneCode.cachedCode : sceneCode.generatedCode;
 
     // [Profiling] Per-scene breakdown to find what dominates events code export.
     gd::LogStatus(
         "  Scene '" + layout.GetName() + "': " +
-        gd::String::From(GetTimeSpent(sceneStartTime)) + "ms, " +
+        gd::String::From(sceneCode.timeSpent) + "ms, " +
         gd::String::From(CountEventsRecursively(layout.GetEvents())) +
-        " events, " + gd::String::From(eventsOutput.size() / 1024) +
-        " KB generated code");
+        " events, " + gd::String::From(code.eventsOutput.size() / 1024) +
+        " KB " + (sceneCode.cachedCode ? "reused" : "generated") + " code");
 
     // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    if (fs.WriteToFile(filename, code.eventsOutput)) {
+      for (auto &include : code.eventsIncludes)
+        InsertUnique(includesFiles, include);
 
       InsertUnique(includesFiles, filename);
     } else {
       lastError = _("Unable to write ") + filename;
       return false;
     }
+
+    if (useEventsCodeCache && !sceneCode.cachedCode) {
+      for (std::size_t d = 0; d < diagnosticReports[i]->Count(); ++d)
+        sceneCode.generatedCode.diagnostics.push_back(
+            diagnosticReports[i]->Get(d));
+      eventsCodeCache.StoreSceneCode(filename,
+                                     std::move(sceneCode.generatedCode));
+    }
   }
 
   return true;
@@ -208,6 +208,17 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the events code generated for scenes that did not change
+   * since a previous export should be reused (false by default).
+   *
+   * \see gdjs::EventsCodeCache
+   */
+  PreviewExportOptions &SetShouldUseEventsCodeCache(bool enable) {
+    shouldUseEventsCodeCache = enable;
+    return *this;
+  }
+
   /**
    * \brief Set if the export should show the full loading screen (false
    * by default, skipping the minimum duration and GDevelop logo).
@@ -395,6 +406,7 @@ struct PreviewExportOptions {
   bool shouldReloadProjectData = true;
   bool shouldReloadLibraries = true;
   bool shouldGenerateScenesEventsCode = true;
+  bool shouldUseEventsCodeCache = false;
   bool fullLoadingScreen;
   bool isDevelopmentEnvironment;
   bool isInGameEdition;
@@ -588,13 +600,21 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   *
+   * The code of the scenes is generated in parallel if
+   * SetCodeGenerationThreadsCount was called with more than 1 thread.
+   *
+   * \param useEventsCodeCache If true, the code of the scenes that did not
+   * change since the last export to the same directory is taken from
+   * gdjs::EventsCodeCache instead of being generated again.
    */
   bool ExportScenesEventsCode(
       const gd::Project &project,
       gd::String outputDir,
       std::vector<gd::String> &includesFiles,
       gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
-      bool exportForPreview);
+      bool exportForPreview,
+      bool useEventsCodeCache = false);
 
   /**
    * \brief Add the project effects include files.
@@ -752,6 +772,20 @@ class ExporterHelper {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Set the number of threads used to generate the events code of the
+   * scenes.
+   *
+   * By default, the code is generated on the calling thread (1). The generated
+   * files and the diagnostic reports are the same whatever the number of
+   * threads.
+   *
+   * \see gd::ParallelFor
+   */
+  void SetCodeGenerationThreadsCount(std::size_t codeGenerationThreadsCount_) {
+    codeGenerationThreadsCount = codeGenerationThreadsCount_;
+  }
+
   static void AddDeprecatedFontFilesToFontResources(
       gd::AbstractFileSystem &fs,
       gd::ResourcesContainer &resourcesManager,
@@ -765,6 +799,14 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount =
+      1;  ///< The number of threads used to generate the scenes events code.
+  std::size_t reusedScenesEventsCodeCount =
+      0;  ///< The number of scenes with their code reused from the cache by
+          ///< the last ExportScenesEventsCode call.
+  std::size_t generatedScenesEventsCodeCount =
+      0;  ///< The number of scenes with their code generated by the last
+          ///< ExportScenesEventsCode call.
 
  private:
    static void SerializeUsedResourcesForRuntime(
@@ -782,6 +824,8 @@ class ExporterHelper {
                                       std::set<gd::String> &usedResources);
    /**
     * \brief Strip a project and serialize it to JSON.
+    *
+    * The stripped parts of the project are restored after the serialization.
     */
    static void StripAndSerializeProjectData(gd::Project &project,
                                              gd::SerializerElement &rootElement,
@@ -11,6 +11,7 @@
 #include <GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h>
 #include <GDCore/Events/Parsers/ExpressionParser2.h>
 #include <GDCore/Events/Parsers/ExpressionParser2Node.h>
+#include <GDCore/Events/Parsers/ParsedExpressionsCache.h>
 #include <GDCore/Extensions/Builtin/SpriteExtension/Animation.h>
 #include <GDCore/Extensions/Builtin/SpriteExtension/Direction.h>
 #include <GDCore/Extensions/Builtin/SpriteExtension/Sprite.h>
@@ -311,6 +312,39 @@ class AbstractFileSystemJS : public AbstractFileSystem {
         destination.c_str());
   }
 
+  virtual bool LinkFile(const gd::String &file, const gd::String &destination) {
+    return (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('linkFile')) return false;
+          return self.linkFile(UTF8ToString($1), UTF8ToString($2));
+        },
+        (int)this,
+        file.c_str(),
+        destination.c_str());
+  }
+
+  virtual bool GetFileInfo(const gd::String &file, FileInfo &fileInfo) {
+    // The information is given as "size:modificationTime[:contentHash]", or
+    // as an empty string if not available.
+    gd::String info = (const char *)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('getFileInfo')) return ensureString('');
+          return ensureString(self.getFileInfo(UTF8ToString($1)));
+        },
+        (int)this,
+        file.c_str());
+
+    std::vector<gd::String> infoParts = info.Split(':');
+    if (infoParts.size() < 2) return false;
+
+    fileInfo.size = infoParts[0].To<uint64_t>();
+    fileInfo.modificationTime = infoParts[1].To<int64_t>();
+    fileInfo.contentHash = infoParts.size() > 2 ? infoParts[2] : "";
+    return true;
+  }
+
   virtual bool ClearDir(const gd::String &directory) {
     return (bool)EM_ASM_INT(
         {
@@ -614,6 +648,9 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
 #define STATIC_GetSafeName GetSafeName
 #define STATIC_ToJSON ToJSON
 #define STATIC_FromJSON(x) FromJSON(x)
+#define STATIC_ToJSONUsingDocument ToJSONUsingDocument
+#define STATIC_FromJSONUsingDocument(x) FromJSONUsingDocument(x)
+#define STATIC_UnserializeFromJSON UnserializeFromJSON
 #define STATIC_SetCanonicalMode SetCanonicalMode
 #define STATIC_IsCanonicalMode IsCanonicalMode
 #define STATIC_SerializeTo SerializeTo
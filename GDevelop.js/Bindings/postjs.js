@@ -189,8 +189,8 @@ var adaptNamingConventions = function (gd) {
     return arr;
   };
 
-  // Add gd.Serializer.fromJSObject which is much faster than manually parsing
-  // JSON with gd.Serializer.fromJSON.
+  // Conversion of JavaScript objects to gd.SerializerElement, one node at a
+  // time. Only used as a fallback by gd.Serializer.fromJSObject.
   const elementFromJSObject = function (object, element) {
     if (typeof object === 'number') {
       element.setDoubleValue(object);
@@ -214,9 +214,26 @@ var adaptNamingConventions = function (gd) {
     }
   };
 
+  // Add gd.Serializer.fromJSObject, which converts the object to JSON and
+  // builds the whole element in a single call to native code (instead of
+  // one call per node). Numbers are stored as doubles, like JavaScript
+  // numbers.
   gd.Serializer.fromJSObject = function (object) {
     var element = new gd.SerializerElement();
-    elementFromJSObject(object, element);
+
+    var json = undefined;
+    try {
+      json = JSON.stringify(object);
+    } catch (error) {
+      // Objects that can't be converted to JSON (with cycles or BigInts)
+      // are converted node by node.
+    }
+    if (
+      json === undefined ||
+      !gd.Serializer.unserializeFromJSON(json, element, true)
+    ) {
+      elementFromJSObject(object, element);
+    }
 
     return element;
   };
@@ -233,7 +250,9 @@ var adaptNamingConventions = function (gd) {
     return null;
   };
 
-  gd.Serializer.toJSObject = function (element) {
+  // Conversion of a gd.SerializerElement to a JavaScript object, one node at
+  // a time. Only used as a fallback by gd.Serializer.toJSObject.
+  const elementToJSObject = function (element) {
     if (!element.isValueUndefined()) {
       return valueToJSObject(element.getValue());
     } else if (element.consideredAsArray()) {
@@ -246,7 +265,7 @@ var adaptNamingConventions = function (gd) {
         const sharedPtrSerializerElement =
           children.getSharedPtrSerializerElement(i);
         const serializerElement = sharedPtrSerializerElement.get();
-        array.push(gd.Serializer.toJSObject(serializerElement));
+        array.push(elementToJSObject(serializerElement));
         sharedPtrSerializerElement.reset();
       }
 
@@ -260,7 +279,7 @@ var adaptNamingConventions = function (gd) {
       for (let i = 0; i < attributeNames.size(); ++i) {
         const name = attributeNames.at(i);
         const serializerValue = attributes.get(name);
-        object[name] = valueToJSObject(element.getValue());
+        object[name] = valueToJSObject(serializerValue);
       }
 
       const children = element.getAllChildren();
@@ -271,7 +290,7 @@ var adaptNamingConventions = function (gd) {
         const sharedPtrSerializerElement =
           children.getSharedPtrSerializerElement(i);
         const serializerElement = sharedPtrSerializerElement.get();
-        object[name] = gd.Serializer.toJSObject(serializerElement);
+        object[name] = elementToJSObject(serializerElement);
         sharedPtrSerializerElement.reset();
       }
       return object;
@@ -279,6 +298,19 @@ var adaptNamingConventions = function (gd) {
     return null;
   };
 
+  // Add gd.Serializer.toJSObject, which gets the JSON of the whole element in
+  // a single call to native code (instead of a few calls per node) and parses
+  // it.
+  gd.Serializer.toJSObject = function (element) {
+    try {
+      return JSON.parse(gd.Serializer.toJSON(element));
+    } catch (error) {
+      // Elements that can't be written as valid JSON (with NaN values) are
+      // converted node by node.
+      return elementToJSObject(element);
+    }
+  };
+
   //Preserve backward compatibility with some alias for methods:
   gd.VectorString.prototype.get = gd.VectorString.prototype.at;
   gd.VectorPlatformExtension.prototype.get =
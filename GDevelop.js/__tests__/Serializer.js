@@ -143,6 +143,39 @@ describe('libGD.js object serialization', function () {
       checkJsonParseAndStringify('[{"a":1},2]');
       checkJsonParseAndStringify('{"7":[],"a":[1,2,{"b":3},{"c":[4,5]},6]}');
     });
+    it('should store numbers as doubles', function () {
+      const element = gd.Serializer.fromJSObject({
+        integer: 3,
+        largeInteger: 4294967296,
+        double: 1.5,
+      });
+      expect(element.getChild('integer').getValue().isDouble()).toBe(true);
+      expect(element.getChild('integer').getDoubleValue()).toBe(3);
+      expect(element.getChild('largeInteger').getDoubleValue()).toBe(
+        4294967296
+      );
+      expect(element.getChild('double').getDoubleValue()).toBe(1.5);
+      element.delete();
+    });
+    it('should convert attributes and children', function () {
+      const element = new gd.SerializerElement();
+      element.setStringAttribute('attribute', 'value');
+      element.setIntAttribute('intAttribute', 4);
+      element.addChild('child').setBoolValue(true);
+      expect(gd.Serializer.toJSObject(element)).toEqual({
+        attribute: 'value',
+        intAttribute: 4,
+        child: true,
+      });
+      element.delete();
+    });
+    it('should convert objects that are not valid JSON', function () {
+      // JSON.stringify throws with BigInts.
+      const element = gd.Serializer.fromJSObject({ a: 1, b: 2n });
+      expect(element.getChild('a').getDoubleValue()).toBe(1);
+      expect(element.hasChild('b')).toBe(true);
+      element.delete();
+    });
   });
 
   describe('gd.Serializer canonical mode', function () {
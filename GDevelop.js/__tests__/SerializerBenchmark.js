@@ -17,6 +17,29 @@ describe.skip('gd.Serializer benchmarks', function () {
       `;
 
   const json = '[' + new Array(1000).fill(partialJson).join(',') + ']';
+
+  // A project-like JSON of a few MB.
+  const makeInstances = (layoutIndex) =>
+    new Array(100).fill(null).map((_, i) => ({
+      angle: 0,
+      layer: '',
+      locked: false,
+      name: 'Object' + i,
+      persistentUuid: 'uuid-' + layoutIndex + '-' + i,
+      x: i * 1.5,
+      y: i * 2,
+      zOrder: i,
+      numberProperties: [{ name: 'animation', value: 0 }],
+      stringProperties: [],
+      initialVariables: [{ name: 'Health', type: 'number', value: 100 }],
+    }));
+  const projectJson = JSON.stringify({
+    properties: { name: 'Benchmark project', version: '1.0.0' },
+    layouts: new Array(200).fill(null).map((_, i) => ({
+      name: 'Layout' + i,
+      instances: makeInstances(i),
+    })),
+  });
   beforeAll(async () => {
     gd = await initializeGDevelopJs();
   });
@@ -36,6 +59,41 @@ describe.skip('gd.Serializer benchmarks', function () {
     console.log(benchmarkSuite.run());
   });
 
+  it('Benchmark JSON string -> SerializerElement (multi-MB project, streaming vs document)', function () {
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 3,
+      iterationsCount: 2,
+    })
+      .add('fromJSON', () => {
+        gd.Serializer.fromJSON(projectJson);
+      })
+      .add('fromJSONUsingDocument', () => {
+        gd.Serializer.fromJSONUsingDocument(projectJson);
+      });
+
+    console.log(benchmarkSuite.run());
+  });
+
+  it('Benchmark SerializerElement -> JSON string (multi-MB project, streaming vs document)', function () {
+    const element = gd.Serializer.fromJSON(projectJson);
+    expect(gd.Serializer.toJSON(element)).toBe(
+      gd.Serializer.toJSONUsingDocument(element)
+    );
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 3,
+      iterationsCount: 2,
+    })
+      .add('toJSON', () => {
+        gd.Serializer.toJSON(element);
+      })
+      .add('toJSONUsingDocument', () => {
+        gd.Serializer.toJSONUsingDocument(element);
+      });
+
+    console.log(benchmarkSuite.run());
+  });
+
   it('Benchmark JavaScript Object -> SerializerElement', function () {
     const jsObject = JSON.parse(json);
     const benchmarkSuite = makeBenchmarkSuite({
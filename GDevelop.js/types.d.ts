@@ -1431,6 +1431,9 @@ export class SharedPtrSerializerElement extends EmscriptenObject {
 export class Serializer extends EmscriptenObject {
   static toJSON(element: SerializerElement): string;
   static fromJSON(json: string): SerializerElement;
+  static toJSONUsingDocument(element: SerializerElement): string;
+  static fromJSONUsingDocument(json: string): SerializerElement;
+  static unserializeFromJSON(json: string, element: SerializerElement, numbersAsDoubles: boolean): boolean;
   static setCanonicalMode(canonical: boolean): void;
   static isCanonicalMode(): boolean;
   static fromJSObject(object: Object): gdSerializerElement;
@@ -2453,6 +2456,16 @@ export class ExpressionParser2 extends EmscriptenObject {
   parseExpression(expression: string): UniquePtrExpressionNode;
 }
 
+export class ParsedExpressionsCache extends EmscriptenObject {
+  static get(): ParsedExpressionsCache;
+  setEnabled(enable: boolean): void;
+  isEnabled(): boolean;
+  getHitsCount(): number;
+  getMissesCount(): number;
+  resetCounters(): void;
+  clear(): void;
+}
+
 export class EventsFunction extends EmscriptenObject {
   constructor();
   clone(): EventsFunction;
@@ -3311,6 +3324,7 @@ export class PreviewExportOptions extends EmscriptenObject {
   setShouldReloadProjectData(enable: boolean): PreviewExportOptions;
   setShouldReloadLibraries(enable: boolean): PreviewExportOptions;
   setShouldGenerateScenesEventsCode(enable: boolean): PreviewExportOptions;
+  setShouldUseEventsCodeCache(enable: boolean): PreviewExportOptions;
   setNativeMobileApp(enable: boolean): PreviewExportOptions;
   setFullLoadingScreen(enable: boolean): PreviewExportOptions;
   setIsDevelopmentEnvironment(enable: boolean): PreviewExportOptions;
@@ -3339,6 +3353,7 @@ export class ExportOptions extends EmscriptenObject {
 export class Exporter extends EmscriptenObject {
   constructor(fs: AbstractFileSystem, gdjsRoot: string);
   setCodeOutputDirectory(path: string): void;
+  setCodeGenerationThreadsCount(count: number): void;
   exportProjectForPixiPreview(options: PreviewExportOptions): boolean;
   exportWholePixiProject(options: ExportOptions): boolean;
   serializeProjectData(project: Project, options: PreviewExportOptions, projectDataElement: SerializerElement): void;
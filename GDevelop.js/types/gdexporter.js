@@ -2,6 +2,7 @@
 declare class gdjsExporter {
   constructor(fs: gdAbstractFileSystem, gdjsRoot: string): void;
   setCodeOutputDirectory(path: string): void;
+  setCodeGenerationThreadsCount(count: number): void;
   exportProjectForPixiPreview(options: gdPreviewExportOptions): boolean;
   exportWholePixiProject(options: gdExportOptions): boolean;
   serializeProjectData(project: gdProject, options: gdPreviewExportOptions, projectDataElement: gdSerializerElement): void;
@@ -5,6 +5,7 @@ declare class gdInitialInstancesContainer {
   getInstancesCount(): number;
   iterateOverInstances(func: gdInitialInstanceFunctor): void;
   iterateOverInstancesWithZOrdering(func: gdInitialInstanceFunctor, layer: string): void;
+  iterateOverInstancesInArea(func: gdInitialInstanceFunctor, left: number, top: number, right: number, bottom: number): void;
   moveInstancesToLayer(fromLayer: string, toLayer: string): void;
   removeAllInstancesOnLayer(layer: string): void;
   removeInitialInstancesOfObject(obj: string): void;
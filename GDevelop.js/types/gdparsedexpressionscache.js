@@ -0,0 +1,12 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdParsedExpressionsCache {
+  static get(): gdParsedExpressionsCache;
+  setEnabled(enable: boolean): void;
+  isEnabled(): boolean;
+  getHitsCount(): number;
+  getMissesCount(): number;
+  resetCounters(): void;
+  clear(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -16,6 +16,7 @@ declare class gdPreviewExportOptions {
   setShouldReloadProjectData(enable: boolean): gdPreviewExportOptions;
   setShouldReloadLibraries(enable: boolean): gdPreviewExportOptions;
   setShouldGenerateScenesEventsCode(enable: boolean): gdPreviewExportOptions;
+  setShouldUseEventsCodeCache(enable: boolean): gdPreviewExportOptions;
   setNativeMobileApp(enable: boolean): gdPreviewExportOptions;
   setFullLoadingScreen(enable: boolean): gdPreviewExportOptions;
   setIsDevelopmentEnvironment(enable: boolean): gdPreviewExportOptions;
@@ -5,6 +5,9 @@ declare class gdSerializer {
 
   static toJSON(element: gdSerializerElement): string;
   static fromJSON(json: string): gdSerializerElement;
+  static toJSONUsingDocument(element: gdSerializerElement): string;
+  static fromJSONUsingDocument(json: string): gdSerializerElement;
+  static unserializeFromJSON(json: string, element: gdSerializerElement, numbersAsDoubles: boolean): boolean;
   static setCanonicalMode(canonical: boolean): void;
   static isCanonicalMode(): boolean;
   delete(): void;
@@ -247,6 +247,7 @@ declare class libGDevelop {
   ExpressionNode: Class<gdExpressionNode>;
   UniquePtrExpressionNode: Class<gdUniquePtrExpressionNode>;
   ExpressionParser2: Class<gdExpressionParser2>;
+  ParsedExpressionsCache: Class<gdParsedExpressionsCache>;
   EventsFunction_FunctionType: Class<EventsFunction_FunctionType>;
   EventsFunction: Class<gdEventsFunction>;
   FunctionFolderOrFunction: Class<gdFunctionFolderOrFunction>;
@@ -223,6 +223,7 @@ export default class BrowserSWPreviewLauncher extends React.Component<
         );
       }
 
+      previewExportOptions.setShouldUseEventsCodeCache(true);
       previewExportOptions.setFullLoadingScreen(
         previewOptions.fullLoadingScreen
       );
@@ -40,6 +40,12 @@ class LocalFileSystem {
    */
   _filesToDownload: { [string]: string } = {};
 
+  /**
+   * True if the file system was found to not support files cloning.
+   * @private
+   */
+  _cloningUnsupported: boolean = false;
+
   constructor(
     options: ?{|
       downloadUrlsToLocalFiles: boolean,
@@ -189,6 +195,35 @@ class LocalFileSystem {
     }
     return true;
   };
+  linkFile = (source: string, dest: string): boolean => {
+    if (this._cloningUnsupported || isURL(source) || source === dest)
+      return false;
+
+    try {
+      // Only clone the file (copy-on-write), when the file system supports it.
+      // Hard links can't be used, as the exported file would then be modified
+      // along with the original one.
+      fs.copyFileSync(source, dest, fs.constants.COPYFILE_FICLONE_FORCE);
+    } catch (e) {
+      if (e.code === 'ENOTSUP' || e.code === 'ENOSYS' || e.code === 'EXDEV') {
+        this._cloningUnsupported = true;
+      }
+      return false;
+    }
+    return true;
+  };
+  getFileInfo = (filePath: string): string => {
+    // URLs are always copied (or downloaded) again.
+    if (isURL(filePath)) return '';
+
+    try {
+      const stat = fs.statSync(filePath);
+      if (!stat.isFile()) return '';
+      return stat.size + ':' + Math.floor(stat.mtimeMs);
+    } catch (e) {
+      return '';
+    }
+  };
   writeToFile = (file: string, contents: string): any => {
     try {
       fs.outputFileSync(file, contents);
@@ -334,6 +334,7 @@ export default class LocalPreviewLauncher extends React.Component<
       );
     }
 
+    previewExportOptions.setShouldUseEventsCodeCache(true);
     previewExportOptions.setFullLoadingScreen(previewOptions.fullLoadingScreen);
     previewExportOptions.setGDevelopVersionWithHash(getIDEVersionWithHash());
     previewExportOptions.setCrashReportUploadLevel(